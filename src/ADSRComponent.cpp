@@ -18,45 +18,25 @@ ADSRComponent::~ADSRComponent()
 
 void ADSRComponent::paint(juce::Graphics& g)
 {
-    auto bounds = getLocalBounds().toFloat().reduced(10);
+    if (getWidth() <= 0 || getHeight() <= 0)
+        return;
 
-    // Draw background with transparency
-    g.setColour(juce::Colours::black.withAlpha(0.3f));
-    g.fillRoundedRectangle(bounds, 5.0f);
+    QualityGovernor::ScopedPaintTimer paintTimer(*governor);
 
-    // Draw border
-    g.setColour(primaryColor.withAlpha(0.5f));
-    g.drawRoundedRectangle(bounds, 5.0f, 2.0f);
+    // Background and grid only change with size, colours or display scale
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!backgroundImage.isValid() || !juce::approximatelyEqual(scale, backgroundScale))
+        updateBackgroundImage(scale);
 
-    // Draw grid lines (optional visual aid)
-    g.setColour(secondaryColor.withAlpha(0.2f));
-    for (int i = 1; i < 4; ++i)
-    {
-        float y = bounds.getY() + (bounds.getHeight() / 4.0f) * i;
-        g.drawLine(bounds.getX(), y, bounds.getRight(), y, 1.0f);
-    }
-
-    // Create and draw ADSR curve
-    auto path = createADSRPath();
+    g.drawImage(backgroundImage, getLocalBounds().toFloat());
 
     // Draw filled area under the curve
-    auto filledPath = path;
-    filledPath.lineTo(bounds.getRight(), bounds.getBottom());
-    filledPath.lineTo(bounds.getX(), bounds.getBottom());
-    filledPath.closeSubPath();
-
     g.setColour(primaryColor.withAlpha(0.2f));
-    g.fillPath(filledPath);
+    g.fillPath(fillPath);
 
     // Draw ADSR curve line
     g.setColour(primaryColor);
-    g.strokePath(path, juce::PathStrokeType(3.0f, juce::PathStrokeType::curved));
-
-    // Get control point positions
-    auto attackPoint = getAttackPoint();
-    auto decayPoint = getDecayPoint();
-    auto sustainPoint = getSustainPoint();
-    auto releasePoint = getReleasePoint();
+    g.strokePath(curvePath, juce::PathStrokeType(3.0f, juce::PathStrokeType::curved));
 
     /**
      * @brief Lambda function to draw control points
@@ -73,15 +53,28 @@ void ADSRComponent::paint(juce::Graphics& g)
     };
 
     // Draw all control points
-    drawControlPoint(attackPoint, currentDragMode == DragMode::Attack);
-    drawControlPoint(decayPoint, currentDragMode == DragMode::Decay);
-    drawControlPoint(sustainPoint, currentDragMode == DragMode::Sustain);
-    drawControlPoint(releasePoint, currentDragMode == DragMode::Release);
+    for (auto mode : {DragMode::Attack, DragMode::Decay, DragMode::Sustain, DragMode::Release})
+        drawControlPoint(getControlPoint(mode), currentDragMode == mode);
+
+    // Draw the playhead of the sounding note
+    if (playheadStage != Envelope::Stage::Idle)
+    {
+        auto bounds = getLocalBounds().toFloat().reduced(10);
+        auto point = getPlayheadPoint();
+
+        g.setColour(juce::Colours::white.withAlpha(0.3f));
+        g.drawVerticalLine(juce::roundToInt(point.x), point.y, bounds.getBottom());
+
+        g.setColour(juce::Colours::white);
+        g.fillEllipse(juce::Rectangle<float>(5.0f, 5.0f).withCentre(point));
+    }
 }
 
 void ADSRComponent::resized()
 {
-    // Called when component size changes - currently no specific layout needed
+    // Background and curve depend on the size, rebuild both
+    backgroundImage = {};
+    updateCurve();
 }
 
 void ADSRComponent::mouseDown(const juce::MouseEvent& event)
@@ -90,10 +83,13 @@ void ADSRComponent::mouseDown(const juce::MouseEvent& event)
     lastMousePos = event.position;
     currentDragMode = getHitTest(event.position);
 
-    // Repaint if we started dragging a control point
+    // Repaint the handle if we started dragging a control point
     if (currentDragMode != DragMode::None)
     {
-        repaint();
+        repaintControlPoint(currentDragMode);
+
+        if (onGestureStart)
+            onGestureStart();
     }
 }
 
@@ -145,15 +141,23 @@ void ADSRComponent::mouseDrag(const juce::MouseEvent& event)
         onParameterChanged(attackValue, decayValue, sustainValue, releaseValue);
     }
 
-    // Trigger visual update
-    repaint();
+    // Trigger visual update of the changed part
+    updateCurve();
 }
 
 void ADSRComponent::mouseUp(const juce::MouseEvent& event)
 {
-    // End drag mode and update visual state
+    // End drag mode and update visual state of the released handle
+    auto releasedMode = currentDragMode;
     currentDragMode = DragMode::None;
-    repaint();
+
+    if (releasedMode != DragMode::None)
+    {
+        repaintControlPoint(releasedMode);
+
+        if (onGestureEnd)
+            onGestureEnd();
+    }
 }
 
 void ADSRComponent::mouseMove(const juce::MouseEvent& event)
@@ -173,35 +177,182 @@ void ADSRComponent::mouseMove(const juce::MouseEvent& event)
 
 void ADSRComponent::setAttack(float attack)
 {
-    attackValue = juce::jlimit(0.01f, 1.0f, attack);
-    repaint();
+    attack = juce::jlimit(0.01f, 1.0f, attack);
+    if (juce::approximatelyEqual(attack, attackValue))
+        return;
+
+    attackValue = attack;
+    updateCurve();
 }
 
 void ADSRComponent::setDecay(float decay)
 {
-    decayValue = juce::jlimit(0.01f, 1.0f, decay);
-    repaint();
+    decay = juce::jlimit(0.01f, 1.0f, decay);
+    if (juce::approximatelyEqual(decay, decayValue))
+        return;
+
+    decayValue = decay;
+    updateCurve();
 }
 
 void ADSRComponent::setSustain(float sustain)
 {
-    sustainValue = juce::jlimit(0.0f, 1.0f, sustain);
-    repaint();
+    sustain = juce::jlimit(0.0f, 1.0f, sustain);
+    if (juce::approximatelyEqual(sustain, sustainValue))
+        return;
+
+    sustainValue = sustain;
+    updateCurve();
 }
 
 void ADSRComponent::setRelease(float release)
 {
-    releaseValue = juce::jlimit(0.01f, 1.0f, release);
-    repaint();
+    release = juce::jlimit(0.01f, 1.0f, release);
+    if (juce::approximatelyEqual(release, releaseValue))
+        return;
+
+    releaseValue = release;
+    updateCurve();
+}
+
+void ADSRComponent::setPlayhead(Envelope::Stage stage, float level)
+{
+    level = juce::jlimit(0.0f, 1.0f, level);
+
+    if (stage == playheadStage && juce::approximatelyEqual(level, playheadLevel))
+        return;
+
+    repaint(getPlayheadBounds().getSmallestIntegerContainer());
+
+    playheadStage = stage;
+    playheadLevel = level;
+
+    repaint(getPlayheadBounds().getSmallestIntegerContainer());
 }
 
 void ADSRComponent::updateColors(juce::Colour primary, juce::Colour secondary)
 {
     primaryColor = primary;
     secondaryColor = secondary;
+
+    // The grid uses the secondary colour
+    backgroundImage = {};
     repaint();
 }
 
+void ADSRComponent::updateBackgroundImage(float scale)
+{
+    backgroundImage = juce::Image(juce::Image::ARGB,
+                                  juce::jmax(1, juce::roundToInt(static_cast<float>(getWidth()) * scale)),
+                                  juce::jmax(1, juce::roundToInt(static_cast<float>(getHeight()) * scale)),
+                                  true);
+    backgroundScale = scale;
+
+    juce::Graphics g(backgroundImage);
+    g.addTransform(juce::AffineTransform::scale(scale));
+
+    auto bounds = getLocalBounds().toFloat().reduced(10);
+
+    // Draw background with transparency
+    g.setColour(juce::Colours::black.withAlpha(0.3f));
+    g.fillRoundedRectangle(bounds, 5.0f);
+
+    // Draw border
+    g.setColour(primaryColor.withAlpha(0.5f));
+    g.drawRoundedRectangle(bounds, 5.0f, 2.0f);
+
+    // Draw grid lines (optional visual aid)
+    g.setColour(secondaryColor.withAlpha(0.2f));
+    for (int i = 1; i < 4; ++i)
+    {
+        float y = bounds.getY() + (bounds.getHeight() / 4.0f) * i;
+        g.drawLine(bounds.getX(), y, bounds.getRight(), y, 1.0f);
+    }
+}
+
+void ADSRComponent::updateCurve()
+{
+    auto bounds = getLocalBounds().toFloat().reduced(10);
+    auto oldCurveBounds = curveBounds;
+
+    curvePath = createADSRPath();
+
+    // Filled area under the curve
+    fillPath = curvePath;
+    fillPath.lineTo(bounds.getRight(), bounds.getBottom());
+    fillPath.lineTo(bounds.getX(), bounds.getBottom());
+    fillPath.closeSubPath();
+
+    // Everything the curve, its fill and the handles can touch
+    curveBounds = fillPath.getBounds().expanded(controlPointMargin);
+
+    repaint(oldCurveBounds.getUnion(curveBounds).getSmallestIntegerContainer());
+}
+
+void ADSRComponent::repaintControlPoint(DragMode mode)
+{
+    auto point = getControlPoint(mode);
+    repaint(juce::Rectangle<float>(2.0f * controlPointMargin, 2.0f * controlPointMargin)
+                .withCentre(point)
+                .getSmallestIntegerContainer());
+}
+
+juce::Point<float> ADSRComponent::getPlayheadPoint() const
+{
+    auto bounds = getLocalBounds().toFloat().reduced(10);
+    auto y = bounds.getBottom() - playheadLevel * bounds.getHeight();
+
+    // Proportion of the current segment's level range covered so far
+    auto along = [](float from, float to, float proportion) {
+        return from + (to - from) * juce::jlimit(0.0f, 1.0f, proportion);
+    };
+
+    switch (playheadStage)
+    {
+        case Envelope::Stage::Attack:
+            return {along(bounds.getX(), getAttackPoint().x, playheadLevel), y};
+        case Envelope::Stage::Decay:
+            return {along(getAttackPoint().x, getDecayPoint().x,
+                          sustainValue < 1.0f ? (1.0f - playheadLevel) / (1.0f - sustainValue) : 1.0f), y};
+        case Envelope::Stage::Sustain:
+            return {along(getDecayPoint().x, getSustainPoint().x, 0.5f), y};
+        case Envelope::Stage::Release:
+            return {along(getSustainPoint().x, getReleasePoint().x,
+                          sustainValue > 0.0f ? 1.0f - playheadLevel / sustainValue : 1.0f), y};
+        default:
+            return {bounds.getX(), bounds.getBottom()};
+    }
+}
+
+juce::Rectangle<float> ADSRComponent::getPlayheadBounds() const
+{
+    if (playheadStage == Envelope::Stage::Idle)
+        return {};
+
+    auto bounds = getLocalBounds().toFloat().reduced(10);
+    auto point = getPlayheadPoint();
+
+    return juce::Rectangle<float>::leftTopRightBottom(point.x, point.y, point.x, bounds.getBottom())
+        .expanded(controlPointMargin);
+}
+
+juce::Point<float> ADSRComponent::getControlPoint(DragMode mode) const
+{
+    switch (mode)
+    {
+        case DragMode::Attack:
+            return getAttackPoint();
+        case DragMode::Decay:
+            return getDecayPoint();
+        case DragMode::Sustain:
+            return getSustainPoint();
+        case DragMode::Release:
+            return getReleasePoint();
+        default:
+            return {};
+    }
+}
+
 juce::Path ADSRComponent::createADSRPath() const
 {
     auto bounds = getLocalBounds().toFloat().reduced(10);
@@ -212,13 +363,16 @@ juce::Path ADSRComponent::createADSRPath() const
     float startY = bounds.getBottom();
     path.startNewSubPath(startX, startY);
 
+    // The segments are drawn as curves matching the exponential envelope:
+    // the attack rises quickly and flattens, decay and release fall quickly and level out
+
     // Attack phase - rise to peak
     auto attackPoint = getAttackPoint();
-    path.lineTo(attackPoint);
+    path.quadraticTo(startX + (attackPoint.x - startX) * 0.3f, attackPoint.y, attackPoint.x, attackPoint.y);
 
     // Decay phase - fall to sustain level
     auto decayPoint = getDecayPoint();
-    path.lineTo(decayPoint);
+    path.quadraticTo(attackPoint.x, decayPoint.y, decayPoint.x, decayPoint.y);
 
     // Sustain phase - horizontal line at sustain level
     auto sustainPoint = getSustainPoint();
@@ -226,7 +380,7 @@ juce::Path ADSRComponent::createADSRPath() const
 
     // Release phase - fall back to zero
     auto releasePoint = getReleasePoint();
-    path.lineTo(releasePoint);
+    path.quadraticTo(sustainPoint.x, releasePoint.y, releasePoint.x, releasePoint.y);
 
     return path;
 }
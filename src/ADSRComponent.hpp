@@ -6,6 +6,8 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "Envelope.hpp"
+#include "QualityGovernor.hpp"
 
 /**
  * @class ADSRComponent
@@ -13,7 +15,8 @@
  *
  * This class provides a visually appealing and interactive interface for editing
  * ADSR envelope parameters (Attack, Decay, Sustain, Release). Users can modify the
- * parameters by dragging control points in real-time.
+ * parameters by dragging control points in real-time. While a note plays, a
+ * playhead follows the envelope stage and level reported by the processor.
  *
  * @inherit juce::Component
  */
@@ -36,7 +39,8 @@ public:
      * @brief Paints the ADSR component
      *
      * Renders the ADSR curve with filled area, control points and grid lines.
-     * Uses gradients and visual effects for an appealing presentation.
+     * Background and grid come from a cached image and the curve from cached
+     * paths, so repaints during a drag only redraw the changed region.
      *
      * @param g Graphics context for drawing
      */
@@ -136,6 +140,16 @@ public:
      */
     float getRelease() const { return releaseValue; }
 
+    /**
+     * @brief Moves the playhead to the current envelope position
+     *
+     * Only the old and the new playhead area are repainted.
+     *
+     * @param stage Current envelope stage (Idle hides the playhead)
+     * @param level Current envelope level (0.0 to 1.0)
+     */
+    void setPlayhead(Envelope::Stage stage, float level);
+
     /**
      * @brief Callback function for parameter changes
      *
@@ -144,6 +158,16 @@ public:
      */
     std::function<void(float attack, float decay, float sustain, float release)> onParameterChanged;
 
+    /**
+     * @brief Called when the user starts dragging a control point
+     */
+    std::function<void()> onGestureStart;
+
+    /**
+     * @brief Called when the user releases a dragged control point
+     */
+    std::function<void()> onGestureEnd;
+
     /**
      * @brief Updates the color scheme of the component
      *
@@ -185,6 +209,16 @@ private:
         Release     ///< Release parameter is being dragged
     };
 
+    /**
+     * @brief Envelope stage shown by the playhead
+     */
+    Envelope::Stage playheadStage = Envelope::Stage::Idle;
+
+    /**
+     * @brief Envelope level shown by the playhead
+     */
+    float playheadLevel = 0.0f;
+
     /**
      * @brief Current drag mode
      */
@@ -205,6 +239,81 @@ private:
      */
     juce::Colour secondaryColor = juce::Colours::darkblue;
 
+    /**
+     * @brief Measures the paint time for the adaptive drawing quality
+     */
+    juce::SharedResourcePointer<QualityGovernor> governor;
+
+    /**
+     * @brief Distance around the curve and the handles that a repaint has to cover
+     *
+     * Half the largest handle plus its outline, which also covers half the curve stroke.
+     */
+    static constexpr float controlPointMargin = 6.0f;
+
+    /**
+     * @brief Pre-rendered background, border and grid at physical resolution
+     */
+    juce::Image backgroundImage;
+
+    /**
+     * @brief Display scale the background image was rendered for
+     */
+    float backgroundScale = 0.0f;
+
+    /**
+     * @brief Cached envelope curve, rebuilt only when a value or the size changes
+     */
+    juce::Path curvePath;
+
+    /**
+     * @brief Cached filled area under the envelope curve
+     */
+    juce::Path fillPath;
+
+    /**
+     * @brief Area covered by the curve, its fill and the handles at the last rebuild
+     */
+    juce::Rectangle<float> curveBounds;
+
+    /**
+     * @brief Renders background, border and grid into backgroundImage
+     * @param scale Physical pixels per logical pixel
+     */
+    void updateBackgroundImage(float scale);
+
+    /**
+     * @brief Rebuilds the cached paths and repaints the old and new curve area
+     */
+    void updateCurve();
+
+    /**
+     * @brief Repaints the area of one control point
+     * @param mode Control point to repaint
+     */
+    void repaintControlPoint(DragMode mode);
+
+    /**
+     * @brief Returns the screen position of the playhead on the curve
+     *
+     * The level gives the vertical position. Horizontally the playhead moves
+     * through the segment of the current stage in proportion to the level
+     * covered so far; during sustain it rests in the middle of the plateau.
+     */
+    juce::Point<float> getPlayheadPoint() const;
+
+    /**
+     * @brief Returns the area covered by the playhead, empty while idle
+     */
+    juce::Rectangle<float> getPlayheadBounds() const;
+
+    /**
+     * @brief Returns the screen position of a control point
+     * @param mode Control point (DragMode::None returns the origin)
+     * @return juce::Point<float> Position of the control point
+     */
+    juce::Point<float> getControlPoint(DragMode mode) const;
+
     /**
      * @brief Creates the graphical path for the ADSR curve
      *
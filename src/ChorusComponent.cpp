@@ -16,6 +16,8 @@ ChorusComponent::ChorusComponent()
         currentRate = static_cast<float>(rateSlider.getValue());
         updateParameters();
     };
+    rateSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    rateSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(rateSlider);
 
     rateLabel.setText("Rate", juce::dontSendNotification);
@@ -32,6 +34,8 @@ ChorusComponent::ChorusComponent()
         currentDepth = static_cast<float>(depthSlider.getValue());
         updateParameters();
     };
+    depthSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    depthSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(depthSlider);
     depthLabel.setText("Depth", juce::dontSendNotification);
     depthLabel.setJustificationType(juce::Justification::centred);
@@ -47,6 +51,8 @@ ChorusComponent::ChorusComponent()
         currentFeedback = static_cast<float>(feedbackSlider.getValue());
         updateParameters();
     };
+    feedbackSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    feedbackSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(feedbackSlider);
 
     feedbackLabel.setText("Feedback", juce::dontSendNotification);
@@ -63,6 +69,8 @@ ChorusComponent::ChorusComponent()
         currentMix = static_cast<float>(mixSlider.getValue());
         updateParameters();
     };
+    mixSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    mixSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(mixSlider);
 
     mixLabel.setText("Mix", juce::dontSendNotification);
@@ -95,11 +103,7 @@ void ChorusComponent::paint(juce::Graphics& g)
     g.fillRoundedRectangle(area.reduced(1), 8.0f);
 
     // Chorus-specific glow effect (slightly more intense)
-    for (float i = 4.0f; i > 0; i -= 0.6f) {
-        auto alpha = (4.0f - i) / 4.0f * 0.1f;
-        g.setColour(juce::Colour(0xff64b5f6).withAlpha(alpha));
-        g.drawRoundedRectangle(area.expanded(i), 8.0f + i, 1.0f);
-    }
+    glowCache->drawGlow(g, area, {juce::Colour(0xff64b5f6), 4.0f, 0.6f, 0.1f, 8.0f, true});
 
     // Main border with varying glow
     g.setColour(juce::Colour(0xff64b5f6).withAlpha(0.7f));
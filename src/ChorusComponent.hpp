@@ -6,6 +6,7 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "GlowCache.hpp"
 
 /**
  * @class ChorusComponent
@@ -88,6 +89,16 @@ public:
      */
     std::function<void(float rate, float depth, float feedback, float mix)> onParameterChanged;
 
+    /**
+     * @brief Called when the user starts dragging one of the knobs
+     */
+    std::function<void()> onGestureStart;
+
+    /**
+     * @brief Called when the user releases a dragged knob
+     */
+    std::function<void()> onGestureEnd;
+
 private:
     /**
      * @brief Calls the parameter changed callback
@@ -157,5 +168,7 @@ private:
      */
     float currentMix = 0.5f;
 
+    juce::SharedResourcePointer<GlowCache> glowCache; ///< Shared glow sprites for the outer glow
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChorusComponent)
 };
\ No newline at end of file
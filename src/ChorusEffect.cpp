@@ -4,6 +4,7 @@
  */
 
 #include "ChorusEffect.hpp"
+#include "FastMath.hpp"
 
 ChorusEffect::ChorusEffect()
 {
@@ -18,16 +19,29 @@ void ChorusEffect::prepare(const juce::dsp::ProcessSpec& spec)
     // Store sample rate for calculations
     sampleRate = static_cast<float>(spec.sampleRate);
 
+    // Calculate initial LFO parameters
+    updateLFO();
+}
+
+void ChorusEffect::allocateBuffers(DspArena& arena, int maximumBlockSize)
+{
     // Calculate delay buffer size - needs to accommodate maximum delay time
     // Add 1 sample for safety margin
-    int delayBufferSize = static_cast<int>(sampleRate * maxDelayTime) + 1;
+    const auto delayBufferSize = static_cast<size_t>(sampleRate * maxDelayTime) + 1;
 
     // Initialize delay lines for stereo processing
-    leftDelayLine.setSize(delayBufferSize);
-    rightDelayLine.setSize(delayBufferSize);
+    leftDelayLine.setBuffer(arena.allocate(delayBufferSize));
+    rightDelayLine.setBuffer(arena.allocate(delayBufferSize));
 
-    // Calculate initial LFO parameters
-    updateLFO();
+    // LFO values are computed for a whole block before the delay lines run
+    lfoValues = arena.allocate(static_cast<size_t>(maximumBlockSize));
+}
+
+void ChorusEffect::reset()
+{
+    leftDelayLine.reset();
+    rightDelayLine.reset();
+    lfoPhase = 0.0f;
 }
 
 void ChorusEffect::processBlock(juce::AudioBuffer<float>& buffer)
@@ -35,41 +49,59 @@ void ChorusEffect::processBlock(juce::AudioBuffer<float>& buffer)
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
 
-    // Process each sample individually for smooth modulation
-    for (int sample = 0; sample < numSamples; ++sample)
+    // Hosts may send more samples than announced, so the LFO buffer is filled in chunks of its size
+    const auto chunkSize = static_cast<int>(lfoValues.size());
+    if (chunkSize == 0)
+        return;
+
+    for (int chunkStart = 0; chunkStart < numSamples; chunkStart += chunkSize)
     {
-        // Generate LFO value using sine wave (-1.0 to +1.0)
-        float lfoValue = std::sin(lfoPhase * juce::MathConstants<float>::twoPi);
+        const auto chunkLength = juce::jmin(chunkSize, numSamples - chunkStart);
+
+        // Collect the LFO phases of the chunk, then evaluate the sine for all of them at once
+        for (int sample = 0; sample < chunkLength; ++sample)
+        {
+            lfoValues[static_cast<size_t>(sample)] = lfoPhase;
 
-        // Advance LFO phase and wrap around at 1.0
-        lfoPhase += lfoPhaseIncrement;
-        if (lfoPhase >= 1.0f)
-            lfoPhase -= 1.0f;
+            // Advance LFO phase and wrap around at 1.0
+            lfoPhase += lfoPhaseIncrement;
+            if (lfoPhase >= 1.0f)
+                lfoPhase -= 1.0f;
+        }
 
-        // Calculate modulated delay time
-        // Base delay + modulation range scaled by LFO and depth
-        float modulatedDelay = baseDelayTime + (depth * maxDelayTime * 0.5f * (lfoValue + 1.0f));
-        float delayInSamples = modulatedDelay * sampleRate;
+        // LFO values from -1.0 to +1.0
+        FastMath::sin2pi(lfoValues.data(), lfoValues.data(), chunkLength);
 
-        // Process each channel
-        for (int channel = 0; channel < numChannels; ++channel)
+        // Process each sample individually for smooth modulation
+        for (int sample = 0; sample < chunkLength; ++sample)
         {
-            // Select appropriate delay line for this channel
-            auto& delayLine = (channel == 0) ? leftDelayLine : rightDelayLine;
+            const float lfoValue = lfoValues[static_cast<size_t>(sample)];
+
+            // Calculate modulated delay time
+            // Base delay + modulation range scaled by LFO and depth
+            float modulatedDelay = baseDelayTime + (depth * maxDelayTime * 0.5f * (lfoValue + 1.0f));
+            float delayInSamples = modulatedDelay * sampleRate;
+
+            // Process each channel
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                // Select appropriate delay line for this channel
+                auto& delayLine = (channel == 0) ? leftDelayLine : rightDelayLine;
 
-            // Get input sample for this channel
-            float inputSample = buffer.getSample(channel, sample);
+                // Get input sample for this channel
+                float inputSample = buffer.getSample(channel, chunkStart + sample);
 
-            // Read delayed sample with interpolation
-            float delayedSample = delayLine.read(delayInSamples);
+                // Read delayed sample with interpolation
+                float delayedSample = delayLine.read(delayInSamples);
 
-            // Apply feedback - delayed signal fed back into delay line
-            float feedbackSample = delayedSample * feedback;
-            delayLine.write(inputSample + feedbackSample);
+                // Apply feedback - delayed signal fed back into delay line
+                float feedbackSample = delayedSample * feedback;
+                delayLine.write(inputSample + feedbackSample);
 
-            // Mix dry (original) and wet (delayed) signals
-            float outputSample = inputSample * (1.0f - mix) + delayedSample * mix;
-            buffer.setSample(channel, sample, outputSample);
+                // Mix dry (original) and wet (delayed) signals
+                float outputSample = inputSample * (1.0f - mix) + delayedSample * mix;
+                buffer.setSample(channel, chunkStart + sample, outputSample);
+            }
         }
     }
 }
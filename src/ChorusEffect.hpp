@@ -6,6 +6,7 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "DspArena.hpp"
 
 /**
  * @class DelayLine
@@ -17,11 +18,19 @@
 class DelayLine {
 public:
     /**
-     * @brief Sets the buffer size of the delay line
-     * @param size Buffer size in samples
+     * @brief Sets the memory of the delay line
+     * @param newBuffer Zeroed sample memory; its size is the maximum delay
      */
-    void setSize(int size) {
-        buffer.resize(size, 0.0f);
+    void setBuffer(std::span<float> newBuffer) {
+        buffer = newBuffer;
+        writeIndex = 0;
+    }
+
+    /**
+     * @brief Clears the stored samples
+     */
+    void reset() {
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
         writeIndex = 0;
     }
 
@@ -55,7 +64,7 @@ public:
     }
 
 private:
-    std::vector<float> buffer;  ///< Circular audio buffer
+    std::span<float> buffer;    ///< Circular audio buffer, in the arena
     int writeIndex = 0;         ///< Current write index
 };
 
@@ -83,12 +92,25 @@ public:
     /**
      * @brief Prepares the effect for audio processing
      *
-     * Initializes delay lines based on sample rate and calculates LFO parameters.
+     * Calculates the LFO parameters for the sample rate. processBlock() also
+     * needs the delay lines from allocateBuffers().
      *
      * @param spec ProcessSpec with sample rate, block size and channel count
      */
     void prepare(const juce::dsp::ProcessSpec& spec);
 
+    /**
+     * @brief Takes the delay lines, sized for the prepared sample rate, and the LFO buffer from the arena
+     * @param arena Arena holding the buffers of the processor
+     * @param maximumBlockSize Number of LFO values computed at once; larger blocks are processed in chunks
+     */
+    void allocateBuffers(DspArena& arena, int maximumBlockSize);
+
+    /**
+     * @brief Clears the delay lines and restarts the LFO
+     */
+    void reset();
+
     /**
      * @brief Processes an audio block with the chorus effect
      *
@@ -155,6 +177,7 @@ private:
     // LFO state
     float lfoPhase = 0.0f;                 ///< Current LFO phase (0.0-1.0)
     float lfoPhaseIncrement = 0.0f;        ///< Phase increment per sample
+    std::span<float> lfoValues;            ///< LFO output for the current block
 
     // Delay lines
     DelayLine leftDelayLine;               ///< Delay line for left channel
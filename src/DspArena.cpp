@@ -0,0 +1,65 @@
+/**
+ * @file DspArena.cpp
+ * @brief Implementation of the DspArena class
+ */
+
+#include "DspArena.hpp"
+
+#if JUCE_MAC || JUCE_LINUX || JUCE_BSD
+#include <sys/mman.h>
+#endif
+
+DspArena::~DspArena()
+{
+    release();
+}
+
+std::span<float> DspArena::allocate(size_t numFloats)
+{
+    const auto numBytes = (numFloats * sizeof(float) + alignment - 1) / alignment * alignment;
+    const auto offset = used;
+    used += numBytes;
+
+    if (sizing)
+        return {};
+
+    jassert(used <= capacity);
+    return {reinterpret_cast<float*>(storage + offset), numFloats};
+}
+
+void DspArena::release()
+{
+    if (storage != nullptr)
+    {
+#if JUCE_MAC || JUCE_LINUX || JUCE_BSD
+        if (locked)
+            munlock(storage, capacity);
+#endif
+
+        ::operator delete(storage, std::align_val_t{alignment});
+    }
+
+    storage = nullptr;
+    capacity = 0;
+    used = 0;
+    locked = false;
+}
+
+void DspArena::allocateStorage()
+{
+    capacity = used;
+    used = 0;
+
+    if (capacity == 0)
+        return;
+
+    storage = static_cast<std::byte*>(::operator new(capacity, std::align_val_t{alignment}));
+
+    // Writing every byte maps all pages now instead of on the first note
+    std::memset(storage, 0, capacity);
+
+    // Keep the buffers out of swap where the system allows it; without the permission this silently fails
+#if JUCE_MAC || JUCE_LINUX || JUCE_BSD
+    locked = mlock(storage, capacity) == 0;
+#endif
+}
@@ -0,0 +1,210 @@
+/**
+ * @file Envelope.cpp
+ * @brief Implementation of the Envelope class
+ */
+
+#include "Envelope.hpp"
+#include "FastMath.hpp"
+
+namespace {
+
+/// Overshoot of the attack asymptote above full level; smaller values give a more curved attack
+constexpr float attackTargetRatio = 0.3f;
+
+/// Undershoot of the decay and release asymptotes below their end levels
+constexpr float decayReleaseTargetRatio = 0.0001f;
+
+/**
+ * @brief log2 of the per-sample factor that covers a segment in the given time
+ * @param time Segment time in seconds
+ * @param sampleRate Sample rate in Hz
+ * @param remainingRatio Distance to the asymptote at the end of the segment relative to the start
+ */
+float getLog2Coefficient(float time, double sampleRate, float remainingRatio)
+{
+    const auto numSamples = juce::jmax(1.0, static_cast<double>(time) * sampleRate);
+    return static_cast<float>(std::log2(static_cast<double>(remainingRatio)) / numSamples);
+}
+
+} // namespace
+
+void Envelope::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    updateSegments();
+    reset();
+}
+
+void Envelope::allocateBuffers(DspArena& arena, int maximumBlockSize)
+{
+    gainBuffer = arena.allocate(static_cast<size_t>(maximumBlockSize));
+}
+
+void Envelope::reset()
+{
+    stage = Stage::Idle;
+    level = 0.0f;
+}
+
+void Envelope::setParameters(const Parameters& newParameters)
+{
+    if (newParameters == parameters)
+        return;
+
+    parameters = newParameters;
+    updateSegments();
+}
+
+void Envelope::noteOn()
+{
+    stage = Stage::Attack;
+}
+
+void Envelope::noteOff()
+{
+    if (stage != Stage::Idle)
+        stage = Stage::Release;
+}
+
+void Envelope::getNextBlock(float* gains, int numSamples)
+{
+    int i = 0;
+
+    while (i < numSamples)
+    {
+        if (stage == Stage::Idle)
+        {
+            std::fill(gains + i, gains + numSamples, 0.0f);
+            return;
+        }
+
+        if (stage == Stage::Sustain)
+        {
+            level = parameters.sustain;
+            std::fill(gains + i, gains + numSamples, level);
+            return;
+        }
+
+        const auto& segment = getSegment();
+        const auto remaining = numSamples - i;
+        const auto startOffset = level - segment.asymptote;
+
+        // The segment ends after n samples where coefficient^n reaches this ratio
+        const auto endRatio = (segment.end - segment.asymptote) / startOffset;
+        const auto finishedAlready = !(endRatio > 0.0f && endRatio < 1.0f);
+        const auto samplesToEnd = finishedAlready ? 0.0f : std::ceil(std::log2(endRatio) / segment.log2Coefficient);
+        const auto finishes = samplesToEnd <= static_cast<float>(remaining);
+        const auto length = finishes ? static_cast<int>(samplesToEnd) : remaining;
+
+        // Closed form of the one-pole recursion, no dependency between the samples
+        auto* out = gains + i;
+        const auto asymptote = segment.asymptote;
+        const auto log2Coefficient = segment.log2Coefficient;
+
+        for (int n = 0; n < length; ++n)
+            out[n] = asymptote + startOffset * FastMath::exp2(log2Coefficient * static_cast<float>(n + 1));
+
+        if (finishes)
+        {
+            // Land exactly on the end level instead of slightly past it
+            if (length > 0)
+                out[length - 1] = segment.end;
+
+            level = segment.end;
+            advanceStage();
+        }
+        else
+        {
+            level = asymptote + startOffset * std::exp2(log2Coefficient * static_cast<float>(length));
+        }
+
+        i += length;
+    }
+}
+
+void Envelope::applyEnvelopeToBuffer(juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    // Constant stages need no gain curve
+    if (stage == Stage::Idle)
+    {
+        buffer.clear(startSample, numSamples);
+        return;
+    }
+
+    if (stage == Stage::Sustain)
+    {
+        level = parameters.sustain;
+        buffer.applyGain(startSample, numSamples, level);
+        return;
+    }
+
+    jassert(!gainBuffer.empty());
+
+    while (numSamples > 0)
+    {
+        const auto blockSize = juce::jmin(numSamples, static_cast<int>(gainBuffer.size()));
+        getNextBlock(gainBuffer.data(), blockSize);
+
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel, startSample), gainBuffer.data(),
+                                                  blockSize);
+
+        startSample += blockSize;
+        numSamples -= blockSize;
+    }
+}
+
+void Envelope::updateSegments()
+{
+    const auto sustain = juce::jlimit(0.0f, 1.0f, parameters.sustain);
+
+    // Attack from zero to full level, aiming at 1 + ratio
+    attackSegment.asymptote = 1.0f + attackTargetRatio;
+    attackSegment.end = 1.0f;
+    attackSegment.log2Coefficient =
+        getLog2Coefficient(parameters.attack, sampleRate, attackTargetRatio / (1.0f + attackTargetRatio));
+
+    // Decay from full level to the sustain level, aiming slightly below it
+    decaySegment.asymptote = sustain - decayReleaseTargetRatio;
+    decaySegment.end = sustain;
+    decaySegment.log2Coefficient = getLog2Coefficient(
+        parameters.decay, sampleRate, decayReleaseTargetRatio / (1.0f - sustain + decayReleaseTargetRatio));
+
+    // Release from full level to zero; releases from lower levels finish proportionally sooner
+    releaseSegment.asymptote = -decayReleaseTargetRatio;
+    releaseSegment.end = 0.0f;
+    releaseSegment.log2Coefficient = getLog2Coefficient(
+        parameters.release, sampleRate, decayReleaseTargetRatio / (1.0f + decayReleaseTargetRatio));
+}
+
+const Envelope::Segment& Envelope::getSegment() const
+{
+    switch (stage)
+    {
+    case Stage::Attack:
+        return attackSegment;
+    case Stage::Decay:
+        return decaySegment;
+    default:
+        return releaseSegment;
+    }
+}
+
+void Envelope::advanceStage()
+{
+    switch (stage)
+    {
+    case Stage::Attack:
+        stage = Stage::Decay;
+        break;
+    case Stage::Decay:
+        stage = Stage::Sustain;
+        break;
+    case Stage::Release:
+        stage = Stage::Idle;
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,166 @@
+/**
+ * @file Envelope.hpp
+ * @brief Block-based ADSR envelope with exponential segments
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "DspArena.hpp"
+
+/**
+ * @class Envelope
+ * @brief ADSR envelope with analogue-style RC segments, rendered a block at a time
+ *
+ * Every segment is the step response of a one-pole filter, like the capacitor
+ * charging and discharging in an analogue envelope generator. The attack aims
+ * above full level and the decay and release slightly below their targets, so
+ * each segment reaches its end point in the set time (the usual "target ratio"
+ * approach of RC envelope emulations).
+ *
+ * Because a segment has the closed form
+ *
+ *     y[n] = asymptote + (y[0] - asymptote) * coefficient^n
+ *
+ * the envelope does not have to be stepped sample by sample. At the start of
+ * a block it works out how many samples are left in the current segment and
+ * fills them with the closed form, which has no sample-to-sample dependency and
+ * vectorises. Applying the envelope is then one vector multiply per channel.
+ */
+class Envelope {
+public:
+    /**
+     * @enum Stage
+     * @brief Envelope state machine
+     */
+    enum class Stage {
+        Idle,    ///< Finished, output is zero
+        Attack,  ///< Rising towards full level
+        Decay,   ///< Falling towards the sustain level
+        Sustain, ///< Holding the sustain level
+        Release  ///< Falling towards zero
+    };
+
+    /**
+     * @struct Parameters
+     * @brief Envelope times and sustain level
+     */
+    struct Parameters {
+        float attack = 0.1f;  ///< Attack time in seconds
+        float decay = 0.1f;   ///< Decay time in seconds
+        float sustain = 1.0f; ///< Sustain level (0.0 to 1.0)
+        float release = 0.1f; ///< Release time in seconds
+
+        bool operator==(const Parameters& other) const = default;
+    };
+
+    /**
+     * @brief Prepares the envelope for playback
+     *
+     * applyEnvelopeToBuffer() also needs the buffer from allocateBuffers().
+     *
+     * @param newSampleRate Sample rate in Hz
+     */
+    void prepare(double newSampleRate);
+
+    /**
+     * @brief Takes the gain buffer used by applyEnvelopeToBuffer() from the arena
+     *
+     * Leaves the envelope state alone.
+     *
+     * @param arena Arena holding the buffers of the processor
+     * @param maximumBlockSize Largest number of samples processed at once
+     */
+    void allocateBuffers(DspArena& arena, int maximumBlockSize);
+
+    /**
+     * @brief Returns the envelope to the idle state at zero level
+     */
+    void reset();
+
+    /**
+     * @brief Sets the envelope parameters
+     *
+     * The segment coefficients are only recomputed when a value actually changed.
+     *
+     * @param newParameters New times and sustain level
+     */
+    void setParameters(const Parameters& newParameters);
+
+    /**
+     * @brief Starts the attack from the current level
+     */
+    void noteOn();
+
+    /**
+     * @brief Starts the release from the current level
+     */
+    void noteOff();
+
+    /**
+     * @brief Checks whether the envelope produces a non-zero output
+     * @return False once the release has finished (or before the first note)
+     */
+    bool isActive() const { return stage != Stage::Idle; }
+
+    /**
+     * @brief Returns the current stage
+     */
+    Stage getStage() const { return stage; }
+
+    /**
+     * @brief Returns the envelope value after the last rendered sample
+     */
+    float getLevel() const { return level; }
+
+    /**
+     * @brief Renders the envelope gains for the next block
+     * @param gains Destination buffer (overwritten)
+     * @param numSamples Number of samples to render
+     */
+    void getNextBlock(float* gains, int numSamples);
+
+    /**
+     * @brief Multiplies all channels of a buffer region by the envelope
+     * @param buffer Buffer to shape
+     * @param startSample First sample of the region
+     * @param numSamples Length of the region in samples
+     */
+    void applyEnvelopeToBuffer(juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+
+private:
+    /**
+     * @brief One exponential segment
+     */
+    struct Segment {
+        float asymptote = 0.0f;       ///< Value the segment converges to
+        float end = 0.0f;             ///< Level at which the segment is finished
+        float log2Coefficient = 0.0f; ///< log2 of the per-sample decay factor (negative)
+    };
+
+    /**
+     * @brief Recomputes the segments from the current parameters
+     */
+    void updateSegments();
+
+    /**
+     * @brief Returns the segment of the current stage
+     */
+    const Segment& getSegment() const;
+
+    /**
+     * @brief Moves on to the stage following the current one
+     */
+    void advanceStage();
+
+    Parameters parameters;          ///< Current parameters
+    double sampleRate = 44100.0;    ///< Current sample rate in Hz
+    Stage stage = Stage::Idle;      ///< Current stage
+    float level = 0.0f;             ///< Envelope value after the last rendered sample
+
+    Segment attackSegment;          ///< Attack segment
+    Segment decaySegment;           ///< Decay segment
+    Segment releaseSegment;         ///< Release segment
+
+    std::span<float> gainBuffer;    ///< Scratch: gains for applyEnvelopeToBuffer(), in the arena
+};
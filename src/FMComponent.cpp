@@ -0,0 +1,149 @@
+/**
+ * @file FMComponent.cpp
+ * @brief Implementation of the FMComponent class
+ */
+
+#include "FMComponent.hpp"
+#include "PluginProcessor.hpp"
+#include <magic_enum/magic_enum.hpp>
+
+FMComponent::FMComponent(juce::AudioProcessorValueTreeState& parameters)
+{
+    using Parameters = AvSynthAudioProcessor::Parameters;
+
+    // Algorithm and feedback are shared by all operators
+    setupRotarySlider(algorithmSlider);
+    algorithmAttachment = std::make_unique<SliderAttachment>(
+        parameters, magic_enum::enum_name<Parameters::FMAlgorithm>().data(), algorithmSlider);
+
+    setupRotarySlider(feedbackSlider);
+    feedbackAttachment = std::make_unique<SliderAttachment>(
+        parameters, magic_enum::enum_name<Parameters::FMFeedback>().data(), feedbackSlider);
+
+    for (auto [label, text] : {std::pair{&algorithmLabel, "Algorithm"}, std::pair{&feedbackLabel, "Feedback"}})
+    {
+        label->setText(text, juce::dontSendNotification);
+        label->setJustificationType(juce::Justification::centred);
+        label->setFont(12.0f);
+        addAndMakeVisible(*label);
+    }
+
+    // Operator sliders, in the order of the operator parameters in the Parameters enum
+    constexpr Parameters op1Parameters[slidersPerOperator] = {Parameters::Op1Ratio,   Parameters::Op1Level,
+                                                              Parameters::Op1Attack,  Parameters::Op1Decay,
+                                                              Parameters::Op1Sustain, Parameters::Op1Release};
+    constexpr const char* parameterNames[slidersPerOperator] = {"Ratio", "Level", "Attack", "Decay", "Sustain", "Release"};
+
+    for (int op = 0; op < FMEngine::numOperators; ++op)
+    {
+        for (int i = 0; i < slidersPerOperator; ++i)
+        {
+            const auto index = static_cast<size_t>(op * slidersPerOperator + i);
+            const auto parameter = AvSynthAudioProcessor::getOperatorParameter(op, op1Parameters[i]);
+
+            setupRotarySlider(operatorSliders[index]);
+            operatorAttachments[index] = std::make_unique<SliderAttachment>(
+                parameters, magic_enum::enum_name(parameter).data(), operatorSliders[index]);
+        }
+
+        auto& button = operatorButtons[static_cast<size_t>(op)];
+        button.setButtonText("OP" + juce::String(op + 1));
+        button.setClickingTogglesState(true);
+        button.setRadioGroupId(1);
+        button.onClick = [this, op] { selectOperator(op); };
+        addAndMakeVisible(button);
+    }
+
+    for (int i = 0; i < slidersPerOperator; ++i)
+    {
+        auto& label = operatorLabels[static_cast<size_t>(i)];
+        label.setText(parameterNames[i], juce::dontSendNotification);
+        label.setJustificationType(juce::Justification::centred);
+        label.setFont(12.0f);
+        addAndMakeVisible(label);
+    }
+
+    operatorButtons[0].setToggleState(true, juce::dontSendNotification);
+    selectOperator(0);
+}
+
+FMComponent::~FMComponent()
+{
+}
+
+void FMComponent::setupRotarySlider(juce::Slider& slider)
+{
+    slider.setSliderStyle(juce::Slider::RotaryVerticalDrag);
+    slider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 60, 20);
+    addAndMakeVisible(slider);
+}
+
+void FMComponent::selectOperator(int index)
+{
+    selectedOperator = index;
+
+    for (size_t i = 0; i < operatorSliders.size(); ++i)
+        operatorSliders[i].setVisible(static_cast<int>(i) / slidersPerOperator == selectedOperator);
+}
+
+void FMComponent::paint(juce::Graphics& g)
+{
+    auto area = getLocalBounds().toFloat();
+    auto headerArea = area.removeFromTop(25);
+
+    // Mystical background with gradient, matching the effect sections
+    auto backgroundGradient = juce::ColourGradient(
+        juce::Colour(0xff2d3e54), 0, 0,
+        juce::Colour(0xff0a0f1c), 0, getHeight(),
+        false
+    );
+    backgroundGradient.addColour(0.5, juce::Colour(0xff4a3472).withAlpha(0.2f));
+
+    g.setGradientFill(backgroundGradient);
+    g.fillRoundedRectangle(area.reduced(1), 8.0f);
+
+    // Main border
+    g.setColour(juce::Colour(0xff64b5f6).withAlpha(0.7f));
+    g.drawRoundedRectangle(area.reduced(1), 8.0f, 1.5f);
+
+    // Header
+    g.setColour(juce::Colour(0xff64b5f6).withAlpha(0.2f));
+    g.fillRoundedRectangle(headerArea.reduced(1), 6.0f);
+
+    g.setFont(juce::Font(14.0f, juce::Font::bold));
+    g.setColour(juce::Colour(0xffc5d1de));
+    g.drawText("FM OPERATORS", headerArea, juce::Justification::centred);
+}
+
+void FMComponent::resized()
+{
+    auto bounds = getLocalBounds().reduced(10);
+    bounds.removeFromTop(25); // Space for title
+
+    // Operator selection as a column of buttons on the left
+    auto buttonArea = bounds.removeFromLeft(60);
+    const auto buttonHeight = buttonArea.getHeight() / FMEngine::numOperators;
+    for (auto& button : operatorButtons)
+        button.setBounds(buttonArea.removeFromTop(buttonHeight).reduced(2));
+
+    // Algorithm, feedback and the six operator sliders share the remaining width
+    const auto sliderWidth = bounds.getWidth() / (2 + slidersPerOperator);
+
+    auto algorithmArea = bounds.removeFromLeft(sliderWidth);
+    algorithmLabel.setBounds(algorithmArea.removeFromBottom(20));
+    algorithmSlider.setBounds(algorithmArea);
+
+    auto feedbackArea = bounds.removeFromLeft(sliderWidth);
+    feedbackLabel.setBounds(feedbackArea.removeFromBottom(20));
+    feedbackSlider.setBounds(feedbackArea);
+
+    for (int i = 0; i < slidersPerOperator; ++i)
+    {
+        auto sliderArea = bounds.removeFromLeft(sliderWidth);
+        operatorLabels[static_cast<size_t>(i)].setBounds(sliderArea.removeFromBottom(20));
+
+        // All operators share the same position, only the selected one is visible
+        for (int op = 0; op < FMEngine::numOperators; ++op)
+            operatorSliders[static_cast<size_t>(op * slidersPerOperator + i)].setBounds(sliderArea);
+    }
+}
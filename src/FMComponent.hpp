@@ -0,0 +1,95 @@
+/**
+ * @file FMComponent.hpp
+ * @brief GUI component for the FM engine parameters
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "FMEngine.hpp"
+
+/**
+ * @class FMComponent
+ * @brief GUI component for controlling the four-operator FM engine
+ *
+ * Shows rotary sliders for algorithm and feedback and the six parameters
+ * (Ratio, Level, Attack, Decay, Sustain, Release) of one operator at a time.
+ * The operator is selected with four toggle buttons. Every operator has its
+ * own set of sliders, all attached to the parameter tree, so switching the
+ * operator only changes which set is visible.
+ *
+ * @inherit juce::Component
+ */
+class FMComponent : public juce::Component {
+public:
+    /**
+     * @brief Constructor
+     *
+     * Creates all sliders and attaches them to the FM parameters.
+     *
+     * @param parameters Parameter tree of the processor
+     */
+    explicit FMComponent(juce::AudioProcessorValueTreeState& parameters);
+
+    /**
+     * @brief Destructor
+     */
+    ~FMComponent() override;
+
+    /**
+     * @brief Paints the FM component
+     *
+     * Renders the mystical background and the "FM OPERATORS" title.
+     *
+     * @param g Graphics context for drawing
+     */
+    void paint(juce::Graphics& g) override;
+
+    /**
+     * @brief Organizes the layout of child components
+     *
+     * Operator buttons on the left, followed by algorithm, feedback and the
+     * six sliders of the selected operator.
+     */
+    void resized() override;
+
+private:
+    /// Number of sliders per operator (Ratio, Level, Attack, Decay, Sustain, Release)
+    static constexpr int slidersPerOperator = 6;
+
+    using SliderAttachment = juce::AudioProcessorValueTreeState::SliderAttachment;
+
+    /**
+     * @brief Shows the sliders of one operator and hides all others
+     * @param index Operator index (0 = OP1 to 3 = OP4)
+     */
+    void selectOperator(int index);
+
+    /**
+     * @brief Applies the common rotary style to a slider and adds it to the component
+     * @param slider Slider to configure
+     */
+    void setupRotarySlider(juce::Slider& slider);
+
+    juce::Slider algorithmSlider;  ///< Operator algorithm (1 to 8)
+    juce::Slider feedbackSlider;   ///< OP4 self-feedback
+    juce::Label algorithmLabel;    ///< Label for the algorithm
+    juce::Label feedbackLabel;     ///< Label for the feedback
+
+    std::unique_ptr<SliderAttachment> algorithmAttachment; ///< Parameter attachment for the algorithm
+    std::unique_ptr<SliderAttachment> feedbackAttachment;  ///< Parameter attachment for the feedback
+
+    std::array<juce::TextButton, FMEngine::numOperators> operatorButtons; ///< Operator selection buttons
+
+    /// Operator sliders, indexed [operator * slidersPerOperator + parameter]
+    std::array<juce::Slider, FMEngine::numOperators * slidersPerOperator> operatorSliders;
+
+    /// Parameter attachments of the operator sliders, same indexing as operatorSliders
+    std::array<std::unique_ptr<SliderAttachment>, FMEngine::numOperators * slidersPerOperator> operatorAttachments;
+
+    std::array<juce::Label, slidersPerOperator> operatorLabels; ///< Labels shared by all operators
+
+    int selectedOperator = 0; ///< Operator whose sliders are visible
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FMComponent)
+};
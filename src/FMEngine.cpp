@@ -0,0 +1,222 @@
+/**
+ * @file FMEngine.cpp
+ * @brief Implementation of the FMEngine class
+ */
+
+#include "FMEngine.hpp"
+#include "FastMath.hpp"
+
+namespace {
+
+/**
+ * @brief Operator routing of one algorithm
+ *
+ * Bit i of modulators[op] is set when operator i modulates operator op.
+ * Modulators always have a higher index than the operator they modulate.
+ */
+struct Algorithm {
+    uint8_t modulators[FMEngine::numOperators]; ///< Modulator mask per operator
+    uint8_t carriers;                           ///< Mask of operators routed to the output
+};
+
+/// The eight classic four-operator algorithms (OP1 = bit 0, OP4 = bit 3)
+constexpr Algorithm algorithms[FMEngine::numAlgorithms] = {
+    {{0b0010, 0b0100, 0b1000, 0}, 0b0001}, // 1: 4 > 3 > 2 > 1
+    {{0b0010, 0b1100, 0, 0}, 0b0001},      // 2: (3 + 4) > 2 > 1
+    {{0b1010, 0b0100, 0, 0}, 0b0001},      // 3: (4 + (3 > 2)) > 1
+    {{0b0110, 0, 0b1000, 0}, 0b0001},      // 4: (2 + (4 > 3)) > 1
+    {{0b0010, 0, 0b1000, 0}, 0b0101},      // 5: 2 > 1, 4 > 3
+    {{0b1000, 0b1000, 0b1000, 0}, 0b0111}, // 6: 4 > (1, 2, 3)
+    {{0, 0, 0b1000, 0}, 0b0111},           // 7: 4 > 3, 2, 1
+    {{0, 0, 0, 0}, 0b1111},                // 8: additive
+};
+
+/// Phase deviation in cycles produced by a modulator at full level (2 pi rad)
+constexpr float modulationDepth = 1.0f;
+
+/// Phase deviation in cycles of the OP4 feedback path at full feedback
+constexpr float feedbackDepth = 0.5f;
+
+/// Operator with self-feedback
+constexpr int feedbackOperator = FMEngine::numOperators - 1;
+
+} // namespace
+
+void FMEngine::prepare(double sampleRate)
+{
+    inverseSampleRate = static_cast<float>(1.0 / sampleRate);
+
+    for (auto& op : operators)
+        op.envelope.prepare(sampleRate);
+
+    reset();
+}
+
+void FMEngine::allocateBuffers(DspArena& arena, int maximumBlockSize)
+{
+    for (auto& op : operators)
+        op.envelope.allocateBuffers(arena, maximumBlockSize);
+
+    for (auto& buffer : operatorOutputs)
+        buffer = arena.allocate(static_cast<size_t>(maximumBlockSize));
+
+    modulationInput = arena.allocate(static_cast<size_t>(maximumBlockSize));
+    envelopeValues = arena.allocate(static_cast<size_t>(maximumBlockSize));
+}
+
+void FMEngine::reset()
+{
+    for (auto& op : operators)
+    {
+        op.envelope.reset();
+        op.phase = 0.0;
+    }
+
+    feedbackHistory[0] = feedbackHistory[1] = 0.0f;
+}
+
+void FMEngine::setAlgorithm(int newAlgorithm)
+{
+    algorithm = juce::jlimit(1, numAlgorithms, newAlgorithm) - 1;
+}
+
+void FMEngine::setFeedback(float newFeedback)
+{
+    feedback = juce::jlimit(0.0f, 1.0f, newFeedback);
+}
+
+void FMEngine::setOperator(int index, const OperatorSettings& settings)
+{
+    auto& op = operators[static_cast<size_t>(index)];
+    op.ratio = settings.ratio;
+    op.level = settings.level;
+    op.envelope.setParameters({settings.attack, settings.decay, settings.sustain, settings.release});
+}
+
+void FMEngine::noteOn()
+{
+    for (auto& op : operators)
+        op.envelope.noteOn();
+}
+
+void FMEngine::noteOff()
+{
+    for (auto& op : operators)
+        op.envelope.noteOff();
+}
+
+void FMEngine::render(float* output, int numSamples, float startFrequency, float endFrequency)
+{
+    jassert(numSamples <= static_cast<int>(modulationInput.size()));
+
+    const auto baseIncrement = startFrequency * inverseSampleRate;
+    const auto baseIncrementStep =
+        numSamples > 0 ? (endFrequency - startFrequency) * inverseSampleRate / static_cast<float>(numSamples) : 0.0f;
+
+    const auto& routing = algorithms[algorithm];
+
+    // Top-down: every modulator is finished before the operators it feeds
+    for (int index = numOperators - 1; index >= 0; --index)
+    {
+        const float* modulation = nullptr;
+
+        if (routing.modulators[index] != 0)
+        {
+            auto* sum = modulationInput.data();
+            std::fill(sum, sum + numSamples, 0.0f);
+
+            for (int source = index + 1; source < numOperators; ++source)
+            {
+                if ((routing.modulators[index] & (1 << source)) == 0)
+                    continue;
+
+                const auto* sourceOutput = operatorOutputs[static_cast<size_t>(source)].data();
+                for (int i = 0; i < numSamples; ++i)
+                    sum[i] += sourceOutput[i] * modulationDepth;
+            }
+
+            modulation = sum;
+        }
+
+        renderOperator(index, modulation, numSamples, baseIncrement, baseIncrementStep);
+    }
+
+    // Mix the carriers, normalised by their count
+    std::fill(output, output + numSamples, 0.0f);
+    int numCarriers = 0;
+
+    for (int index = 0; index < numOperators; ++index)
+    {
+        if ((routing.carriers & (1 << index)) == 0)
+            continue;
+
+        const auto* carrierOutput = operatorOutputs[static_cast<size_t>(index)].data();
+        for (int i = 0; i < numSamples; ++i)
+            output[i] += carrierOutput[i];
+
+        ++numCarriers;
+    }
+
+    juce::FloatVectorOperations::multiply(output, 1.0f / static_cast<float>(juce::jmax(1, numCarriers)), numSamples);
+}
+
+void FMEngine::renderOperator(int index, const float* modulation, int numSamples, float baseIncrement,
+                              float baseIncrementStep)
+{
+    auto& op = operators[static_cast<size_t>(index)];
+    auto* out = operatorOutputs[static_cast<size_t>(index)].data();
+    auto* envelope = envelopeValues.data();
+
+    op.envelope.getNextBlock(envelope, numSamples);
+
+    // Closed-form phase of the linearly ramped frequency, relative to the block start
+    const auto startPhase = static_cast<float>(op.phase);
+    const auto increment = baseIncrement * op.ratio;
+    const auto incrementStep = baseIncrementStep * op.ratio;
+    const auto level = op.level;
+
+    if (index == feedbackOperator)
+    {
+        // Feedback depends on the previous output, so this operator stays scalar.
+        // Averaging the last two outputs keeps high feedback from oscillating at Nyquist.
+        const auto feedbackAmount = feedback * feedbackDepth * 0.5f;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto n = static_cast<float>(i);
+            auto phase = startPhase + increment * n + incrementStep * 0.5f * n * (n - 1.0f);
+            phase += feedbackAmount * (feedbackHistory[0] + feedbackHistory[1]);
+
+            if (modulation != nullptr)
+                phase += modulation[i];
+
+            out[i] = FastMath::sin2pi(phase) * level * envelope[i];
+            feedbackHistory[1] = feedbackHistory[0];
+            feedbackHistory[0] = out[i];
+        }
+    }
+    else if (modulation != nullptr)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto n = static_cast<float>(i);
+            const auto phase = startPhase + increment * n + incrementStep * 0.5f * n * (n - 1.0f) + modulation[i];
+            out[i] = FastMath::sin2pi(phase) * level * envelope[i];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto n = static_cast<float>(i);
+            const auto phase = startPhase + increment * n + incrementStep * 0.5f * n * (n - 1.0f);
+            out[i] = FastMath::sin2pi(phase) * level * envelope[i];
+        }
+    }
+
+    // Advance and wrap in double so long notes do not lose phase precision
+    const auto blockLength = static_cast<double>(numSamples);
+    op.phase += static_cast<double>(increment) * blockLength +
+                static_cast<double>(incrementStep) * 0.5 * blockLength * (blockLength - 1.0);
+    op.phase -= std::floor(op.phase);
+}
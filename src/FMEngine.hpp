@@ -0,0 +1,142 @@
+/**
+ * @file FMEngine.hpp
+ * @brief Four-operator phase-modulation (FM) synthesis engine
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "DspArena.hpp"
+#include "Envelope.hpp"
+#include <array>
+
+/**
+ * @class FMEngine
+ * @brief Phase-modulation synthesis with four sine operators, eight algorithms and feedback
+ *
+ * The algorithms follow the classic four-operator layouts (OP1 is always a carrier,
+ * OP4 is the operator with self-feedback). Every operator has its own frequency
+ * ratio, output level and ADSR envelope.
+ *
+ * Rendering is operator-major: each operator is computed for the whole block
+ * before the next one, starting with OP4. Modulators only ever feed operators
+ * with a lower index, so the modulation input of an operator is complete when it
+ * is rendered, and apart from the feedback operator every inner loop is free of
+ * sample-to-sample dependencies and uses the vectorisable FastMath::sin2pi().
+ */
+class FMEngine {
+public:
+    static constexpr int numOperators = 4;  ///< Number of operators
+    static constexpr int numAlgorithms = 8; ///< Number of operator algorithms
+
+    /**
+     * @struct OperatorSettings
+     * @brief Parameters of a single operator
+     */
+    struct OperatorSettings {
+        float ratio = 1.0f;    ///< Frequency ratio relative to the note frequency
+        float level = 1.0f;    ///< Output level (modulation depth for modulators)
+        float attack = 0.01f;  ///< Envelope attack time in seconds
+        float decay = 0.3f;    ///< Envelope decay time in seconds
+        float sustain = 0.7f;  ///< Envelope sustain level (0.0 to 1.0)
+        float release = 0.3f;  ///< Envelope release time in seconds
+    };
+
+    /**
+     * @brief Prepares the engine for playback
+     *
+     * render() also needs the buffers from allocateBuffers().
+     *
+     * @param sampleRate Sample rate in Hz
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * @brief Takes the per-block scratch buffers from the arena
+     *
+     * Leaves phases and envelopes alone.
+     *
+     * @param arena Arena holding the buffers of the processor
+     * @param maximumBlockSize Largest number of samples passed to render(); longer blocks must be split by the caller
+     */
+    void allocateBuffers(DspArena& arena, int maximumBlockSize);
+
+    /**
+     * @brief Resets phases, envelopes and feedback history
+     */
+    void reset();
+
+    /**
+     * @brief Selects the operator algorithm
+     * @param newAlgorithm Algorithm number (1 to 8)
+     */
+    void setAlgorithm(int newAlgorithm);
+
+    /**
+     * @brief Sets the self-feedback amount of OP4
+     * @param newFeedback Feedback amount (0.0 to 1.0)
+     */
+    void setFeedback(float newFeedback);
+
+    /**
+     * @brief Sets the parameters of one operator
+     * @param index Operator index (0 = OP1 to 3 = OP4)
+     * @param settings New operator parameters
+     */
+    void setOperator(int index, const OperatorSettings& settings);
+
+    /**
+     * @brief Starts the envelopes of all operators
+     */
+    void noteOn();
+
+    /**
+     * @brief Releases the envelopes of all operators
+     */
+    void noteOff();
+
+    /**
+     * @brief Renders a block of mono output
+     *
+     * The note frequency is ramped linearly from startFrequency to endFrequency over the block.
+     *
+     * @param output Destination buffer (overwritten)
+     * @param numSamples Number of samples (at most the prepared block size)
+     * @param startFrequency Note frequency at the start of the block in Hz
+     * @param endFrequency Note frequency at the end of the block in Hz
+     */
+    void render(float* output, int numSamples, float startFrequency, float endFrequency);
+
+private:
+    /**
+     * @brief State of one operator
+     */
+    struct Operator {
+        Envelope envelope;             ///< Amplitude envelope
+        float ratio = 1.0f;            ///< Frequency ratio
+        float level = 1.0f;            ///< Output level
+        double phase = 0.0;            ///< Normalised phase at the start of the next block
+    };
+
+    /**
+     * @brief Renders one operator into its output buffer
+     *
+     * @param index Operator index
+     * @param modulation Summed modulator outputs in cycles, or nullptr
+     * @param numSamples Number of samples to render
+     * @param baseIncrement Phase increment of the note frequency at the first sample
+     * @param baseIncrementStep Change of the phase increment per sample
+     */
+    void renderOperator(int index, const float* modulation, int numSamples, float baseIncrement,
+                        float baseIncrementStep);
+
+    std::array<Operator, numOperators> operators; ///< Operator states
+    int algorithm = 0;                            ///< Current algorithm (0-based)
+    float feedback = 0.0f;                        ///< OP4 self-feedback amount
+    float feedbackHistory[2] = {};                ///< Last two OP4 outputs for the feedback path
+    float inverseSampleRate = 1.0f / 44100.0f;    ///< Cached 1 / sample rate
+
+    std::array<std::span<float>, numOperators> operatorOutputs; ///< Block output per operator
+    std::span<float> modulationInput;    ///< Scratch: summed modulation of the current operator
+    std::span<float> envelopeValues;     ///< Scratch: envelope of the current operator
+};
@@ -0,0 +1,236 @@
+/**
+ * @file FastMath.hpp
+ * @brief Polynomial approximations of transcendental functions for the audio thread
+ *
+ * All functions are branch-free (selects, abs and copysign only) and use no library calls, so loops
+ * calling them over a block of samples are auto-vectorised by the compiler.
+ * The trigonometric functions take the phase in cycles (one period = 1.0) and also
+ * come as juce::dsp::SIMDRegister<float> overloads for code that works on whole registers.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include <bit>
+#include <cstdint>
+
+namespace FastMath {
+
+/**
+ * @brief Largest integer not greater than x, as int32
+ * @param x Input value (must fit into an int32)
+ * @return floor(x)
+ */
+inline int32_t floorToInt(float x) {
+    // The correction is done on the integer, which is if-converted even where float
+    // selects are not (GCC without -fno-trapping-math)
+    auto truncated = static_cast<int32_t>(x);
+    truncated -= static_cast<float>(truncated) > x ? 1 : 0;
+    return truncated;
+}
+
+/**
+ * @brief Branch-free floor that vectorises without SSE4.1
+ * @param x Input value (must fit into an int32)
+ * @return Largest integer value not greater than x
+ */
+inline float floor(float x) { return static_cast<float>(FastMath::floorToInt(x)); }
+
+/**
+ * @brief Fast 2^x
+ *
+ * Splits x into integer and fractional part, evaluates a degree-5 minimax
+ * polynomial for 2^f on [0, 1) and inserts the integer part into the exponent bits.
+ * Maximum relative error: 1.8e-7 (7.5e-8 from the polynomial, the rest float rounding).
+ * The exponent is clamped to [-126, 126], so results saturate near 2^-126 and 2^127.
+ *
+ * @param x Exponent (must fit into an int32)
+ * @return Approximation of 2^x
+ */
+inline float exp2(float x) {
+    auto integerPart = FastMath::floorToInt(x);
+    const auto f = x - static_cast<float>(integerPart);
+
+    auto p = 0.001877576645f;
+    p = p * f + 0.008989340163f;
+    p = p * f + 0.05582631799f;
+    p = p * f + 0.2401536171f;
+    p = p * f + 0.6931530732f;
+    p = p * f + 0.9999999251f;
+
+    integerPart = integerPart < -126 ? -126 : integerPart;
+    integerPart = integerPart > 126 ? 126 : integerPart;
+
+    const auto exponentBits = static_cast<uint32_t>(integerPart + 127) << 23;
+    return p * std::bit_cast<float>(exponentBits);
+}
+
+/**
+ * @brief Fast e^x, see exp2() for accuracy
+ * @param x Exponent (clamped to about [-87, 87])
+ * @return Approximation of e^x
+ */
+inline float exp(float x) { return FastMath::exp2(x * 1.4426950409f); }
+
+/**
+ * @brief Fast ln(1 + y) for y in [0, 1]
+ *
+ * Uses ln(1 + y) = 2 atanh(t) with t = y / (2 + y) <= 1/3 and the odd atanh
+ * series up to t^11. Maximum absolute error: 2.3e-7.
+ *
+ * @param y Input in [0, 1]
+ * @return Approximation of ln(1 + y)
+ */
+inline float log1pUnit(float y) {
+    const auto t = y / (2.0f + y);
+    const auto t2 = t * t;
+
+    auto p = 1.0f / 11.0f;
+    p = p * t2 + 1.0f / 9.0f;
+    p = p * t2 + 1.0f / 7.0f;
+    p = p * t2 + 1.0f / 5.0f;
+    p = p * t2 + 1.0f / 3.0f;
+    p = p * t2 + 1.0f;
+
+    return 2.0f * t * p;
+}
+
+/**
+ * @brief Fast hyperbolic tangent
+ *
+ * Evaluated as (1 - e^-2|x|) / (1 + e^-2|x|) with the sign restored, so it
+ * saturates exactly at +/-1. Maximum absolute error: 1.3e-7.
+ *
+ * @param x Input value
+ * @return Approximation of tanh(x)
+ */
+inline float tanh(float x) {
+    const auto e = FastMath::exp(-2.0f * std::abs(x));
+    return std::copysign((1.0f - e) / (1.0f + e), x);
+}
+
+/**
+ * @brief Fast ln(cosh(x)), the antiderivative of tanh(x)
+ *
+ * Evaluated as |x| + ln(1 + e^-2|x|) - ln(2), which never overflows.
+ * Maximum absolute error: 3e-7 plus the rounding of |x|.
+ *
+ * @param x Input value
+ * @return Approximation of ln(cosh(x))
+ */
+inline float logCosh(float x) {
+    const auto magnitude = std::abs(x);
+    return magnitude + FastMath::log1pUnit(FastMath::exp(-2.0f * magnitude)) - 0.6931471806f;
+}
+
+namespace detail {
+
+/// Odd minimax polynomial for sin(2 pi r) on [-0.25, 0.25]: r * (c0 + c1 r^2 + ... + c4 r^8)
+constexpr float sinCoefficients[] = {6.28318516009f, -41.3416550315f, 81.6010040763f, -76.5497823533f,
+                                     39.5367064641f};
+
+/**
+ * @brief Evaluates the sine polynomial on a phase already reduced to [-0.25, 0.25]
+ * @tparam T float or juce::dsp::SIMDRegister<float>
+ */
+template <typename T>
+inline T sinPolynomial(T r) {
+    const auto r2 = r * r;
+    auto p = r2 * sinCoefficients[4] + sinCoefficients[3];
+    p = p * r2 + sinCoefficients[2];
+    p = p * r2 + sinCoefficients[1];
+    p = p * r2 + sinCoefficients[0];
+    return r * p;
+}
+
+} // namespace detail
+
+/**
+ * @brief Fast sin(2 pi x) for a phase given in cycles
+ *
+ * Reduces x to r in [-0.5, 0.5], folds r into [-0.25, 0.25] using the symmetry
+ * sin(pi - a) = sin(a) and evaluates an odd degree-9 minimax polynomial.
+ * Maximum absolute error: 3.3e-9 from the polynomial plus float rounding of the
+ * reduced phase (about 2e-7 in total for |x| < 8; grows with |x| as the phase loses bits).
+ *
+ * @param x Phase in cycles (must fit into an int32)
+ * @return Approximation of sin(2 pi x)
+ */
+inline float sin2pi(float x) {
+    const auto r = x - FastMath::floor(x + 0.5f);
+    const auto upper = 0.5f - r < r ? 0.5f - r : r;
+    const auto folded = -0.5f - r > upper ? -0.5f - r : upper;
+    return detail::sinPolynomial(folded);
+}
+
+/**
+ * @brief Fast cos(2 pi x) for a phase given in cycles, see sin2pi() for accuracy
+ * @param x Phase in cycles (must fit into an int32)
+ * @return Approximation of cos(2 pi x)
+ */
+inline float cos2pi(float x) { return FastMath::sin2pi(x + 0.25f); }
+
+//==============================================================================
+// SIMD variants, one phase per lane. juce::dsp::SIMDRegister<float> has SSE and NEON
+// backends only, so it is always 4 lanes wide, even on AVX machines.
+
+/**
+ * @brief Branch-free floor for every lane of a SIMD register
+ * @param x Input values (must fit into an int32)
+ * @return Lane-wise floor of x
+ */
+inline juce::dsp::SIMDRegister<float> floor(juce::dsp::SIMDRegister<float> x) {
+    using Register = juce::dsp::SIMDRegister<float>;
+    const auto truncated = Register::truncate(x);
+    return truncated - (Register::expand(1.0f) & Register::greaterThan(truncated, x));
+}
+
+/**
+ * @brief Lane-wise sin(2 pi x), identical results to the scalar sin2pi()
+ * @param x Phases in cycles (must fit into an int32)
+ * @return Approximation of sin(2 pi x) per lane
+ */
+inline juce::dsp::SIMDRegister<float> sin2pi(juce::dsp::SIMDRegister<float> x) {
+    using Register = juce::dsp::SIMDRegister<float>;
+    const auto r = x - FastMath::floor(x + Register::expand(0.5f));
+    const auto upper = Register::min(r, Register::expand(0.5f) - r);
+    const auto folded = Register::max(upper, Register::expand(-0.5f) - r);
+    return detail::sinPolynomial(folded);
+}
+
+/**
+ * @brief Lane-wise cos(2 pi x), see sin2pi()
+ * @param x Phases in cycles (must fit into an int32)
+ * @return Approximation of cos(2 pi x) per lane
+ */
+inline juce::dsp::SIMDRegister<float> cos2pi(juce::dsp::SIMDRegister<float> x) {
+    return FastMath::sin2pi(x + juce::dsp::SIMDRegister<float>::expand(0.25f));
+}
+
+/**
+ * @brief Computes sin(2 pi x) for a block of phases
+ *
+ * Processes whole SIMD registers and finishes the remainder with the scalar
+ * version. Input and output may be the same buffer and need not be aligned.
+ *
+ * @param phases Phases in cycles
+ * @param output Destination buffer
+ * @param numSamples Number of values
+ */
+inline void sin2pi(const float* phases, float* output, int numSamples) {
+    using Register = juce::dsp::SIMDRegister<float>;
+    constexpr auto width = static_cast<int>(Register::SIMDNumElements);
+
+    int i = 0;
+    for (; i + width <= numSamples; i += width) {
+        alignas(Register::SIMDRegisterSize) float lanes[width];
+        std::copy(phases + i, phases + i + width, lanes);
+        FastMath::sin2pi(Register::fromRawArray(lanes)).copyToRawArray(lanes);
+        std::copy(lanes, lanes + width, output + i);
+    }
+
+    for (; i < numSamples; ++i)
+        output[i] = FastMath::sin2pi(phases[i]);
+}
+
+} // namespace FastMath
@@ -0,0 +1,73 @@
+/**
+ * @file FilterResponse.cpp
+ * @brief Implementation of the FilterResponse class
+ */
+
+#include "FilterResponse.hpp"
+
+namespace {
+
+/**
+ * @brief Reduces one side of a biquad to the polynomial in sin^2(w/2) of its squared magnitude
+ * @param c0 Coefficient of z^0
+ * @param c1 Coefficient of z^-1
+ * @param c2 Coefficient of z^-2
+ */
+std::array<double, 3> getPowerTerms(double c0, double c1, double c2)
+{
+    const auto sum = c0 + c1 + c2;
+    return {sum * sum, -4.0 * (c0 * c1 + 4.0 * c0 * c2 + c1 * c2), 16.0 * c0 * c2};
+}
+
+} // namespace
+
+void FilterResponse::prepare(double newSampleRate, float newMinFrequency, float newMaxFrequency, int numPoints)
+{
+    if (juce::approximatelyEqual(newSampleRate, sampleRate) && juce::approximatelyEqual(newMinFrequency, minFrequency) &&
+        juce::approximatelyEqual(newMaxFrequency, maxFrequency) && static_cast<int>(sinSquared.size()) == numPoints)
+        return;
+
+    sampleRate = newSampleRate;
+    minFrequency = newMinFrequency;
+    maxFrequency = newMaxFrequency;
+
+    const auto size = static_cast<size_t>(numPoints);
+    sinSquared.resize(size);
+    powerGains.resize(size);
+    magnitudesDb.assign(size, 0.0f);
+
+    const auto ratio = static_cast<double>(maxFrequency) / static_cast<double>(minFrequency);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const auto proportion = numPoints > 1 ? static_cast<double>(i) / static_cast<double>(numPoints - 1) : 0.0;
+        const auto frequency = static_cast<double>(minFrequency) * std::pow(ratio, proportion);
+        const auto sinHalfOmega = std::sin(juce::MathConstants<double>::pi * frequency / sampleRate);
+
+        sinSquared[i] = sinHalfOmega * sinHalfOmega;
+    }
+}
+
+void FilterResponse::compute(std::initializer_list<Coefficients> stages)
+{
+    const auto size = powerGains.size();
+    std::fill(powerGains.begin(), powerGains.end(), 1.0);
+
+    for (const auto& stage : stages)
+    {
+        const auto numerator = getPowerTerms(stage[0], stage[1], stage[2]);
+        const auto denominator = getPowerTerms(stage[3], stage[4], stage[5]);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto p = sinSquared[i];
+            const auto num = numerator[0] + (numerator[1] + numerator[2] * p) * p;
+            const auto den = denominator[0] + (denominator[1] + denominator[2] * p) * p;
+            powerGains[i] *= num / den;
+        }
+    }
+
+    // Power to dB, clamped so that zeros of the response stay finite
+    for (size_t i = 0; i < size; ++i)
+        magnitudesDb[i] = static_cast<float>(10.0 * std::log10(juce::jmax(powerGains[i], 1.0e-12)));
+}
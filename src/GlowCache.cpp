@@ -0,0 +1,117 @@
+/**
+ * @file GlowCache.cpp
+ * @brief Implementation of the GlowCache class
+ */
+
+#include "GlowCache.hpp"
+
+namespace {
+
+/// Nine-patch grid cell (column, row) of every sprite patch, clockwise from the top-left corner
+constexpr int patchCells[8][2] = {{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}};
+
+} // namespace
+
+void GlowCache::drawGlow(juce::Graphics& g, const juce::Rectangle<float>& area, Style style)
+{
+    if (!governor->shouldDrawGlows())
+        return;
+
+    // Normalise the key: ring alphas come from maxAlpha, and nearby corner sizes share a sprite
+    style.colour = style.colour.withAlpha(1.0f);
+    style.cornerSize = std::round(style.cornerSize * 2.0f) * 0.5f;
+
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto& sprite = getSprite(style, scale);
+
+    // Logical sizes of the sprite regions
+    const auto padding = static_cast<float>(sprite.padding) / scale;
+    const auto inset = static_cast<float>(sprite.inset) / scale;
+
+    if (area.getWidth() < 2.0f * inset || area.getHeight() < 2.0f * inset)
+    {
+        drawRings(g, area, style);
+        return;
+    }
+
+    // Images are drawn with the alpha of the current colour, so draw them fully opaque
+    juce::Graphics::ScopedSaveState state(g);
+    g.setOpacity(1.0f);
+
+    // Column and row edges of the eight destination pieces
+    const float xs[4] = {area.getX() - padding, area.getX() + inset, area.getRight() - inset, area.getRight() + padding};
+    const float ys[4] = {area.getY() - padding, area.getY() + inset, area.getBottom() - inset, area.getBottom() + padding};
+
+    for (size_t i = 0; i < sprite.patches.size(); ++i)
+    {
+        const auto& patch = sprite.patches[i];
+        const auto column = patchCells[i][0];
+        const auto row = patchCells[i][1];
+
+        const auto width = xs[column + 1] - xs[column];
+        const auto height = ys[row + 1] - ys[row];
+
+        g.drawImageTransformed(patch,
+                               juce::AffineTransform::scale(width / static_cast<float>(patch.getWidth()),
+                                                            height / static_cast<float>(patch.getHeight()))
+                                   .translated(xs[column], ys[row]));
+    }
+}
+
+void GlowCache::drawRings(juce::Graphics& g, const juce::Rectangle<float>& area, const Style& style)
+{
+    for (float i = style.radius; i > 0; i -= style.step)
+    {
+        auto alpha = (style.radius - i) / style.radius * style.maxAlpha;
+        g.setColour(style.colour.withAlpha(alpha));
+        g.drawRoundedRectangle(area.expanded(i), style.cornerSize + (style.growCorners ? i : 0.0f), 1.0f);
+    }
+}
+
+const GlowCache::Sprite& GlowCache::getSprite(const Style& style, float scale)
+{
+    for (const auto& sprite : sprites)
+        if (sprite.style == style && juce::approximatelyEqual(sprite.scale, scale))
+            return sprite;
+
+    if (sprites.size() >= maxSprites)
+        sprites.clear();
+
+    Sprite sprite;
+    sprite.style = style;
+    sprite.scale = scale;
+
+    // The outermost ring stroke reaches half a pixel beyond the radius, the
+    // corner rounding reaches cornerSize into the area
+    sprite.padding = static_cast<int>(std::ceil((style.radius + 1.0f) * scale));
+    sprite.inset = static_cast<int>(std::ceil((style.cornerSize + 1.0f) * scale));
+
+    // Core with a one pixel wide stretchable middle, surrounded by the glow
+    const auto coreSize = 2 * sprite.inset + 1;
+    const auto imageSize = coreSize + 2 * sprite.padding;
+
+    juce::Image image(juce::Image::ARGB, imageSize, imageSize, true);
+    {
+        juce::Graphics g(image);
+        g.addTransform(juce::AffineTransform::scale(scale));
+
+        const auto core = juce::Rectangle<float>(static_cast<float>(sprite.padding), static_cast<float>(sprite.padding),
+                                                 static_cast<float>(coreSize), static_cast<float>(coreSize)) /
+                          scale;
+        drawRings(g, core, style);
+    }
+
+    // Pixel edges of the nine-patch grid, identical for both axes
+    const int edges[4] = {0, sprite.padding + sprite.inset, sprite.padding + sprite.inset + 1, imageSize};
+
+    for (size_t i = 0; i < sprite.patches.size(); ++i)
+    {
+        const auto column = patchCells[i][0];
+        const auto row = patchCells[i][1];
+        sprite.patches[i] = image.getClippedImage(juce::Rectangle<int>::leftTopRightBottom(
+            edges[column], edges[row], edges[column + 1], edges[row + 1]));
+    }
+
+    sprites.push_back(std::move(sprite));
+    return sprites.back();
+}
@@ -0,0 +1,90 @@
+/**
+ * @file GlowCache.hpp
+ * @brief Pre-rendered nine-patch sprites for the mystical glow effects
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "QualityGovernor.hpp"
+
+/**
+ * @class GlowCache
+ * @brief Draws rounded-rectangle glows from cached nine-patch sprites
+ *
+ * A glow consists of concentric rounded-rectangle outlines whose alpha fades
+ * out towards the outside. Drawing it directly costs one antialiased path
+ * stroke per ring. The cache instead renders the rings once around a small
+ * core rectangle and cuts the result into four corners and four edges. A glow
+ * of any size is then drawn as eight image blits, with the edges stretched
+ * along their length (the glow profile is constant there).
+ *
+ * Sprites are keyed by style and display scale. One instance is shared by
+ * all users through juce::SharedResourcePointer.
+ *
+ * Glows are skipped while the QualityGovernor has lowered the drawing quality.
+ */
+class GlowCache {
+public:
+    /**
+     * @struct Style
+     * @brief Appearance of a glow
+     */
+    struct Style {
+        juce::Colour colour;       ///< Glow colour (its alpha is ignored)
+        float radius = 8.0f;       ///< Distance of the outermost ring from the area
+        float step = 1.0f;         ///< Distance between neighbouring rings
+        float maxAlpha = 0.1f;     ///< Alpha the rings fade towards, reached next to the area
+        float cornerSize = 0.0f;   ///< Corner radius of the area
+        bool growCorners = false;  ///< Whether the ring corner radius grows with the ring distance
+
+        bool operator==(const Style& other) const = default;
+    };
+
+    /**
+     * @brief Draws a glow around a rectangle
+     *
+     * Falls back to drawing the rings directly when the area is too small
+     * to hold the sprite corners. Draws nothing while the QualityGovernor
+     * has switched glows off.
+     *
+     * @param g Graphics context to draw into
+     * @param area Rectangle to glow around
+     * @param style Glow appearance
+     */
+    void drawGlow(juce::Graphics& g, const juce::Rectangle<float>& area, Style style);
+
+    /**
+     * @brief Draws the glow rings directly, without the cache
+     * @param g Graphics context to draw into
+     * @param area Rectangle to glow around
+     * @param style Glow appearance
+     */
+    static void drawRings(juce::Graphics& g, const juce::Rectangle<float>& area, const Style& style);
+
+private:
+    /**
+     * @brief Rendered glow, cut into nine-patch pieces
+     */
+    struct Sprite {
+        Style style;                     ///< Style the sprite was rendered with
+        float scale = 1.0f;              ///< Physical pixels per logical pixel
+        int padding = 0;                 ///< Physical width of the glow outside the core
+        int inset = 0;                   ///< Physical width of the corner region inside the core
+        std::array<juce::Image, 8> patches; ///< Corners and edges, clockwise from the top-left corner
+    };
+
+    /**
+     * @brief Returns the sprite for a style, rendering it on first use
+     * @param style Glow appearance
+     * @param scale Physical pixels per logical pixel
+     */
+    const Sprite& getSprite(const Style& style, float scale);
+
+    /// Upper bound for the number of cached sprites; the cache is cleared when it is reached
+    static constexpr size_t maxSprites = 64;
+
+    std::vector<Sprite> sprites; ///< Cached sprites
+
+    juce::SharedResourcePointer<QualityGovernor> governor; ///< Decides whether glows are drawn
+};
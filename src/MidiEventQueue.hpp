@@ -0,0 +1,86 @@
+/**
+ * @file MidiEventQueue.hpp
+ * @brief Wait-free single-producer single-consumer queue for short MIDI messages
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @class MidiEventQueue
+ * @brief Hands MIDI events from the message thread to the audio thread without locking
+ *
+ * A fixed-size ring buffer with one writer and one reader. The producer only
+ * advances the write index and the consumer only the read index, so neither
+ * side ever waits for the other. When the queue is full, new events are
+ * rejected rather than overwriting events the consumer has not read yet.
+ *
+ * Only short messages (up to three bytes) are queued; that covers every
+ * message the on-screen keyboard and the editor produce.
+ *
+ * @tparam capacity Number of slots, a power of two
+ */
+template <size_t capacity> class MidiEventQueue {
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "The capacity must be a power of two");
+
+  public:
+    /**
+     * @struct Event
+     * @brief One queued MIDI message
+     */
+    struct Event {
+        double timestamp = 0.0;        ///< Time the event was pushed, in juce::Time::getMillisecondCounterHiRes() units
+        std::array<uint8_t, 3> data{}; ///< Raw message bytes
+        uint8_t size = 0;              ///< Number of valid bytes in data
+    };
+
+    /**
+     * @brief Adds an event (producer thread only, wait-free)
+     * @param data Raw message bytes
+     * @param size Number of bytes, 1 to 3
+     * @param timestamp Time of the event in milliseconds
+     * @return False if the queue was full or the message too long; the event is dropped
+     */
+    bool push(const uint8_t *data, int size, double timestamp) noexcept {
+        if (size <= 0 || size > 3)
+            return false;
+
+        const auto write = writeIndex.load(std::memory_order_relaxed);
+        if (write - readIndex.load(std::memory_order_acquire) == capacity)
+            return false;
+
+        auto &event = events[write & (capacity - 1)];
+        event.timestamp = timestamp;
+        std::memcpy(event.data.data(), data, static_cast<size_t>(size));
+        event.size = static_cast<uint8_t>(size);
+
+        writeIndex.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest event (consumer thread only, wait-free)
+     * @param event Receives the event; left unchanged if the queue was empty
+     * @return False if there was no event
+     */
+    bool pop(Event &event) noexcept {
+        const auto read = readIndex.load(std::memory_order_relaxed);
+        if (read == writeIndex.load(std::memory_order_acquire))
+            return false;
+
+        event = events[read & (capacity - 1)];
+        readIndex.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+  private:
+    std::array<Event, capacity> events{}; ///< Ring buffer slots
+
+    // Indices only ever grow; kept on separate cache lines so the two threads do not share one
+    alignas(64) std::atomic<size_t> writeIndex{0}; ///< Number of events pushed so far
+    alignas(64) std::atomic<size_t> readIndex{0};  ///< Number of events popped so far
+};
@@ -0,0 +1,76 @@
+/**
+ * @file MysticalImageLoader.cpp
+ * @brief Implementation of the MysticalImageLoader class
+ */
+
+#include "MysticalImageLoader.hpp"
+
+MysticalImageLoader::MysticalImageLoader() : juce::Thread("Mystical Image Loader")
+{
+    startThread();
+}
+
+MysticalImageLoader::~MysticalImageLoader()
+{
+    // Decoding cannot be interrupted, so wait for it
+    stopThread(-1);
+}
+
+juce::Image MysticalImageLoader::getImage() const
+{
+    const juce::ScopedLock scopedLock(imageLock);
+    return image;
+}
+
+void MysticalImageLoader::run()
+{
+    auto loadedImage = loadImage();
+
+    {
+        const juce::ScopedLock scopedLock(imageLock);
+        image = std::move(loadedImage);
+    }
+
+    sendChangeMessage();
+}
+
+juce::Image MysticalImageLoader::loadImage()
+{
+    // Option 1: in das Plugin eingebettetes Bild
+    auto loadedImage = juce::ImageFileFormat::loadFrom(BinaryData::Pan_jpg, BinaryData::Pan_jpgSize);
+
+    // Option 2: Bild aus dem Resources-Ordner
+    if (!loadedImage.isValid())
+    {
+        const auto imageFile = juce::File::getCurrentWorkingDirectory()
+                                   .getChildFile("..")
+                                   .getChildFile("Resources")
+                                   .getChildFile("Pan.jpg");
+
+        if (imageFile.existsAsFile())
+            loadedImage = juce::ImageFileFormat::loadFrom(imageFile);
+    }
+
+    // Option 3: Fallback - einfarbiges Bild wenn Laden fehlschlägt
+    if (!loadedImage.isValid())
+    {
+        // Software image, since it is rendered off the message thread
+        loadedImage = juce::Image(juce::Image::ARGB, 200, 150, true, juce::SoftwareImageType());
+        juce::Graphics g(loadedImage);
+
+        // Mystischer Verlauf als Fallback
+        auto gradient = juce::ColourGradient(juce::Colour(0xff4a3472), 0, 0, juce::Colour(0xff0a0f1c), 200, 150, false);
+        gradient.addColour(0.5, juce::Colour(0xff64b5f6).withAlpha(0.3f));
+
+        g.setGradientFill(gradient);
+        g.fillAll();
+
+        // Mystische Silhouette als Platzhalter
+        g.setColour(juce::Colour(0xff1a2332).withAlpha(0.7f));
+        juce::Path mysticalShape;
+        mysticalShape.addEllipse(75, 50, 50, 80);
+        g.fillPath(mysticalShape);
+    }
+
+    return loadedImage;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file MysticalImageLoader.hpp
+ * @brief Background decoding of the mystical Pan image
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class MysticalImageLoader
+ * @brief Decodes the Pan image on a background thread and shares it between editors
+ *
+ * Decoding the embedded JPEG takes a noticeable part of the time it takes to
+ * open the editor. The loader starts decoding on its own thread as soon as it
+ * is created, so the editor can open immediately and draw its background
+ * without the image until the decoded image arrives. Listeners are notified
+ * through the message thread once the image is ready.
+ *
+ * One instance is shared by all open editors through
+ * juce::SharedResourcePointer, so the image is only decoded once.
+ */
+class MysticalImageLoader : public juce::ChangeBroadcaster, private juce::Thread {
+public:
+    /**
+     * @brief Constructor, starts decoding the image
+     */
+    MysticalImageLoader();
+
+    /**
+     * @brief Destructor, waits for the decoding to finish
+     */
+    ~MysticalImageLoader() override;
+
+    /**
+     * @brief Returns the decoded image
+     * @return The image, or an invalid image while it is still being decoded
+     */
+    juce::Image getImage() const;
+
+private:
+    /**
+     * @brief Thread entry point, decodes the image and notifies the listeners
+     */
+    void run() override;
+
+    /**
+     * @brief Loads the Pan image
+     *
+     * Tries the image embedded in the binary data, then Resources/Pan.jpg next
+     * to the working directory, and finally renders a placeholder gradient.
+     */
+    static juce::Image loadImage();
+
+    juce::CriticalSection imageLock; ///< Guards image
+    juce::Image image;               ///< Decoded image, invalid until run() has finished
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MysticalImageLoader)
+};
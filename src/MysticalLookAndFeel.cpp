@@ -483,10 +483,12 @@ juce::ColourGradient MysticalLookAndFeel::createRadialGradient(const juce::Recta
  * @param glowColor Color of the glow effect
  * @param glowRadius Radius of the glow effect in pixels
  *
- * Creates mystical glow effects by drawing multiple concentric rectangles
+ * Creates mystical glow effects from multiple concentric rectangles
  * with decreasing alpha values. The effect starts at the specified radius
  * and fades inward, creating a soft, atmospheric glow that enhances
- * the mystical theme without overwhelming the interface.
+ * the mystical theme without overwhelming the interface. The rectangles
+ * are pre-rendered once per style by the shared GlowCache, so each glow
+ * costs a few image blits.
  *
  * The glow effect is used for:
  * - Interactive element highlighting
@@ -497,10 +499,5 @@ juce::ColourGradient MysticalLookAndFeel::createRadialGradient(const juce::Recta
 void MysticalLookAndFeel::drawGlowEffect(juce::Graphics& g, const juce::Rectangle<float>& area,
                                         const juce::Colour& glowColor, float glowRadius) const
 {
-    for (float i = glowRadius; i > 0; i -= 1.0f)
-    {
-        auto alpha = (glowRadius - i) / glowRadius * 0.1f;
-        g.setColour(glowColor.withAlpha(alpha));
-        g.drawRoundedRectangle(area.expanded(i), area.getHeight() * 0.1f, 1.0f);
-    }
+    glowCache->drawGlow(g, area, {glowColor, glowRadius, 1.0f, 0.1f, area.getHeight() * 0.1f, false});
 }
\ No newline at end of file
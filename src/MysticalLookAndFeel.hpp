@@ -1,6 +1,7 @@
 #pragma once
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "GlowCache.hpp"
 
 /**
  * @file MysticalLookAndFeel.hpp
@@ -197,6 +198,8 @@ private:
     static const juce::Colour glowColor;       ///< Bright glow color for effects (0xff64b5f6)
     static const juce::Colour textColor;       ///< Light text color for readability (0xffc5d1de)
 
+    juce::SharedResourcePointer<GlowCache> glowCache; ///< Pre-rendered glow sprites shared with the components
+
     //==============================================================================
     // Helper Methods for Visual Effects
 
@@ -235,8 +238,8 @@ private:
      * @param glowColor Color of the glow effect
      * @param glowRadius Radius/intensity of the glow (default: 8.0f)
      *
-     * Creates atmospheric glow effects by drawing multiple
-     * concentric rounded rectangles with decreasing opacity.
+     * Creates atmospheric glow effects from multiple concentric
+     * rounded rectangles with decreasing opacity, drawn from cached sprites.
      * Used for buttons, sliders, and other interactive elements.
      */
     void drawGlowEffect(juce::Graphics& g, const juce::Rectangle<float>& area,
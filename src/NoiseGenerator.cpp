@@ -0,0 +1,153 @@
+/**
+ * @file NoiseGenerator.cpp
+ * @brief Implementation of the NoiseGenerator class
+ */
+
+#include "NoiseGenerator.hpp"
+#include <bit>
+
+namespace {
+
+/**
+ * @brief Advances a xorshift32 generator
+ * @param state Generator state (must not be zero)
+ * @return New state
+ */
+inline uint32_t xorshift(uint32_t state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/**
+ * @brief Converts random bits to a float in [-1, 1)
+ *
+ * The upper 23 bits become the mantissa of a float in [2, 4), which is then shifted down.
+ */
+inline float toBipolarFloat(uint32_t bits)
+{
+    return std::bit_cast<float>((bits >> 9) | 0x40000000u) - 3.0f;
+}
+
+/// Output gains that bring pink and brown noise to roughly the RMS level of the white noise (1 / sqrt(3), about 0.577).
+/// Unscaled, the Kellet filter reaches an RMS of about 1.7 and the leaky integrator about 0.057.
+constexpr float pinkGain = 0.34f;
+constexpr float brownGain = 10.0f;
+
+/// Corner frequency of the modulation smoothing in Hz
+constexpr double modulationSmoothingHz = 8.0;
+
+} // namespace
+
+void NoiseGenerator::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+}
+
+void NoiseGenerator::seed(juce::Random& random)
+{
+    // xorshift must never be seeded with zero
+    for (auto& state : laneStates)
+        state = static_cast<uint32_t>(random.nextInt()) | 1u;
+
+    modulationState = static_cast<uint32_t>(random.nextInt()) | 1u;
+
+    pinkStates[0] = pinkStates[1] = pinkStates[2] = 0.0f;
+    brownState = 0.0f;
+    modulationValue = 0.0f;
+}
+
+void NoiseGenerator::setType(Type newType)
+{
+    type = newType;
+}
+
+void NoiseGenerator::process(float* output, int numSamples)
+{
+    if (type == Type::Off)
+    {
+        juce::FloatVectorOperations::clear(output, numSamples);
+        return;
+    }
+
+    processWhite(output, numSamples);
+
+    if (type == Type::Pink)
+    {
+        // Paul Kellet's economy pink filter
+        auto b0 = pinkStates[0];
+        auto b1 = pinkStates[1];
+        auto b2 = pinkStates[2];
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto white = output[i];
+            b0 = 0.99765f * b0 + white * 0.0990460f;
+            b1 = 0.96300f * b1 + white * 0.2965164f;
+            b2 = 0.57000f * b2 + white * 1.0526913f;
+            output[i] = (b0 + b1 + b2 + white * 0.1848f) * pinkGain;
+        }
+
+        pinkStates[0] = b0;
+        pinkStates[1] = b1;
+        pinkStates[2] = b2;
+    }
+    else if (type == Type::Brown)
+    {
+        // Leaky integrator; the leak keeps the output from drifting away
+        auto state = brownState;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            state = (state + 0.02f * output[i]) * (1.0f / 1.02f);
+            output[i] = state * brownGain;
+        }
+
+        brownState = state;
+    }
+}
+
+void NoiseGenerator::processWhite(float* output, int numSamples)
+{
+    // Local copy, so the compiler knows the states do not alias the output
+    alignas(32) uint32_t states[numLanes];
+    std::copy(std::begin(laneStates), std::end(laneStates), states);
+
+    int i = 0;
+
+    // Whole groups: every lane produces one sample, the lanes are independent
+    for (; i + numLanes <= numSamples; i += numLanes)
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            states[lane] = xorshift(states[lane]);
+            output[i + lane] = toBipolarFloat(states[lane]);
+        }
+    }
+
+    // Remaining samples of the block
+    for (int lane = 0; i < numSamples; ++i, ++lane)
+    {
+        states[lane] = xorshift(states[lane]);
+        output[i] = toBipolarFloat(states[lane]);
+    }
+
+    std::copy(std::begin(states), std::end(states), laneStates);
+}
+
+float NoiseGenerator::nextModulationSample()
+{
+    modulationState = xorshift(modulationState);
+    return toBipolarFloat(modulationState);
+}
+
+float NoiseGenerator::getNextModulationValue(int numSamples)
+{
+    const auto coefficient = static_cast<float>(
+        1.0 - std::exp(-juce::MathConstants<double>::twoPi * modulationSmoothingHz * numSamples / sampleRate));
+
+    modulationValue += coefficient * (nextModulationSample() - modulationValue);
+    return modulationValue;
+}
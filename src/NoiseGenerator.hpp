@@ -0,0 +1,102 @@
+/**
+ * @file NoiseGenerator.hpp
+ * @brief White, pink and brown noise source for the oscillator section
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include <cstdint>
+
+/**
+ * @class NoiseGenerator
+ * @brief Block-based noise generator usable as oscillator layer and modulation source
+ *
+ * White noise comes from several independent xorshift32 generators that are
+ * stepped in parallel, one per SIMD lane, and converted to float by writing the
+ * random bits straight into the mantissa. This costs a few integer operations
+ * per sample instead of a call into std::rand or juce::Random.
+ *
+ * Pink noise is the white noise filtered by Paul Kellet's three-pole "economy"
+ * filter (within 0.5 dB of -3 dB/octave above 40 Hz), brown noise a leaky
+ * integrator of the white noise.
+ */
+class NoiseGenerator {
+public:
+    /**
+     * @enum Type
+     * @brief Available noise colours
+     */
+    enum class Type {
+        Off,      ///< No noise
+        White,    ///< Flat spectrum
+        Pink,     ///< -3 dB per octave
+        Brown,    ///< -6 dB per octave
+        NumTypes  ///< Total number of noise types
+    };
+
+    /**
+     * @brief Prepares the generator for playback
+     * @param newSampleRate Sample rate in Hz
+     */
+    void prepare(double newSampleRate);
+
+    /**
+     * @brief Seeds all generator lanes and clears the filter states
+     * @param random Random number generator to draw the seeds from
+     */
+    void seed(juce::Random& random);
+
+    /**
+     * @brief Selects the noise colour
+     * @param newType Noise type
+     */
+    void setType(Type newType);
+
+    /**
+     * @brief Fills a buffer with noise of the selected colour
+     * @param output Destination buffer (overwritten, silent for Type::Off)
+     * @param numSamples Number of samples to generate
+     */
+    void process(float* output, int numSamples);
+
+    /**
+     * @brief Advances the modulation output by one block
+     *
+     * The modulation output is a random value per block, smoothed with a
+     * one-pole low-pass at about 8 Hz so that it can drive pitch or level
+     * without zipper noise. It is independent of the selected noise colour.
+     *
+     * @param numSamples Length of the block in samples
+     * @return Slowly varying random value in [-1, 1]
+     */
+    float getNextModulationValue(int numSamples);
+
+private:
+    /// Number of xorshift generators stepped in parallel
+    static constexpr int numLanes = 8;
+
+    /**
+     * @brief Fills a buffer with white noise in [-1, 1)
+     * @param output Destination buffer
+     * @param numSamples Number of samples to generate
+     */
+    void processWhite(float* output, int numSamples);
+
+    /**
+     * @brief Draws one white noise sample from the modulation generator
+     * @return Uniform random value in [-1, 1)
+     */
+    float nextModulationSample();
+
+    Type type = Type::Off;      ///< Selected noise colour
+    double sampleRate = 44100.0; ///< Current sample rate in Hz
+
+    alignas(32) uint32_t laneStates[numLanes] = {1, 2, 3, 4, 5, 6, 7, 8}; ///< xorshift32 state per lane
+
+    float pinkStates[3] = {};   ///< Kellet filter poles
+    float brownState = 0.0f;    ///< Leaky integrator state
+
+    uint32_t modulationState = 9;  ///< xorshift32 state of the modulation output
+    float modulationValue = 0.0f;  ///< Smoothed modulation output
+};
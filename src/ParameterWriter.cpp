@@ -0,0 +1,106 @@
+/**
+ * @file ParameterWriter.cpp
+ * @brief Implementation of the ParameterWriter class
+ */
+
+#include "ParameterWriter.hpp"
+
+ParameterWriter::ParameterWriter(juce::AudioProcessorValueTreeState& state,
+                                 std::initializer_list<const char*> parameterIDs)
+{
+    slots.reserve(parameterIDs.size());
+
+    for (const auto* parameterID : parameterIDs)
+    {
+        Slot slot;
+        slot.parameter = state.getParameter(parameterID);
+        jassert(slot.parameter != nullptr);
+        slots.push_back(slot);
+    }
+}
+
+ParameterWriter::~ParameterWriter()
+{
+    endGesture();
+}
+
+void ParameterWriter::setValue(size_t index, float value)
+{
+    jassert(index < slots.size());
+    auto& slot = slots[index];
+
+    if (slot.parameter == nullptr)
+        return;
+
+    // convertTo0to1 snaps to the parameter interval, so sub-step mouse movements compare equal
+    const auto normalisedValue = slot.parameter->convertTo0to1(value);
+
+    if (!slot.pending && juce::approximatelyEqual(normalisedValue, slot.parameter->getValue()))
+        return;
+
+    slot.pendingValue = normalisedValue;
+    slot.pending = true;
+
+    if (!isTimerRunning())
+        startTimerHz(flushRateHz);
+}
+
+void ParameterWriter::beginGesture()
+{
+    gestureActive = true;
+}
+
+void ParameterWriter::endGesture()
+{
+    flush();
+    gestureActive = false;
+
+    for (auto& slot : slots)
+    {
+        if (slot.inGesture)
+        {
+            slot.parameter->endChangeGesture();
+            slot.inGesture = false;
+        }
+    }
+}
+
+void ParameterWriter::flush()
+{
+    stopTimer();
+
+    for (auto& slot : slots)
+    {
+        if (!slot.pending)
+            continue;
+
+        slot.pending = false;
+
+        // The value may have returned to where it was since it was queued
+        if (juce::approximatelyEqual(slot.pendingValue, slot.parameter->getValue()))
+            continue;
+
+        if (gestureActive)
+        {
+            // Only parameters that actually change get a gesture
+            if (!slot.inGesture)
+            {
+                slot.parameter->beginChangeGesture();
+                slot.inGesture = true;
+            }
+
+            slot.parameter->setValueNotifyingHost(slot.pendingValue);
+        }
+        else
+        {
+            slot.parameter->beginChangeGesture();
+            slot.parameter->setValueNotifyingHost(slot.pendingValue);
+            slot.parameter->endChangeGesture();
+        }
+    }
+}
+
+void ParameterWriter::timerCallback()
+{
+    flush();
+}
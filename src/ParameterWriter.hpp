@@ -0,0 +1,86 @@
+/**
+ * @file ParameterWriter.hpp
+ * @brief Coalescing, gesture-aware parameter writes from custom GUI components
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class ParameterWriter
+ * @brief Writes values from custom components to a fixed set of parameters
+ *
+ * Custom components report all of their values on every mouse event. Writing
+ * them straight to the parameters notifies the host for every parameter on
+ * every event, outside of any change gesture. The writer instead:
+ *
+ * - looks the parameters up once on construction
+ * - keeps only the latest value per parameter and flushes at frame rate
+ * - skips values that match the current parameter value
+ * - wraps writes between beginGesture() and endGesture() in host gestures,
+ *   started lazily for the parameters that actually change
+ *
+ * Writes outside a gesture (e.g. text box edits) get a gesture of their own.
+ * Must only be used on the message thread.
+ */
+class ParameterWriter : private juce::Timer {
+public:
+    /**
+     * @brief Constructor
+     * @param state Parameter tree holding the parameters
+     * @param parameterIDs IDs of the written parameters; their order defines the indices used by setValue()
+     */
+    ParameterWriter(juce::AudioProcessorValueTreeState& state, std::initializer_list<const char*> parameterIDs);
+
+    /**
+     * @brief Destructor, flushes pending values and ends open gestures
+     */
+    ~ParameterWriter() override;
+
+    /**
+     * @brief Queues a new value for a parameter
+     * @param index Index of the parameter in the constructor list
+     * @param value New value in the parameter's range (not normalised)
+     */
+    void setValue(size_t index, float value);
+
+    /**
+     * @brief Marks the start of a user interaction (e.g. a drag)
+     */
+    void beginGesture();
+
+    /**
+     * @brief Flushes pending values and ends the gestures of the parameters that changed
+     */
+    void endGesture();
+
+    /**
+     * @brief Sends all pending values to the host immediately
+     */
+    void flush();
+
+private:
+    /**
+     * @brief Timer callback, flushes the values queued since the last frame
+     */
+    void timerCallback() override;
+
+    /**
+     * @brief Write state of one parameter
+     */
+    struct Slot {
+        juce::RangedAudioParameter* parameter = nullptr; ///< Written parameter
+        float pendingValue = 0.0f;                      ///< Latest queued value (normalised)
+        bool pending = false;                           ///< Whether pendingValue still has to be sent
+        bool inGesture = false;                         ///< Whether a host gesture was started for the parameter
+    };
+
+    /// Rate at which queued values are sent to the host
+    static constexpr int flushRateHz = 60;
+
+    std::vector<Slot> slots;    ///< One slot per parameter
+    bool gestureActive = false; ///< Whether beginGesture() was called without endGesture()
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterWriter)
+};
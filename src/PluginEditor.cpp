@@ -4,10 +4,24 @@
 #include "ReverbComponent.hpp"
 #include "ChorusComponent.hpp"
 #include <magic_enum/magic_enum.hpp>
+#include <bit>
 
 //==============================================================================
 AvSynthAudioProcessorEditor::AvSynthAudioProcessorEditor(AvSynthAudioProcessor &p)
     : AudioProcessorEditor(&p), processorRef(p),
+      adsrWriter(p.parameters, {magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Attack>().data(),
+                                magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Decay>().data(),
+                                magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Sustain>().data(),
+                                magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Release>().data()}),
+      reverbWriter(p.parameters, {magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbRoomSize>().data(),
+                                  magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDamping>().data(),
+                                  magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWetLevel>().data(),
+                                  magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDryLevel>().data(),
+                                  magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWidth>().data()}),
+      chorusWriter(p.parameters, {magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusRate>().data(),
+                                  magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusDepth>().data(),
+                                  magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusFeedback>().data(),
+                                  magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusMix>().data()}),
       gainSlider(juce::Slider::LinearHorizontal, juce::Slider::TextEntryBoxPosition::TextBoxLeft),
       gainAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Gain>().data(), gainSlider),
 
@@ -27,6 +41,40 @@ AvSynthAudioProcessorEditor::AvSynthAudioProcessorEditor(AvSynthAudioProcessor &
       highCutFreqAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::HighPassFreq>().data(),
                             highCutFreqSlider),
 
+      unisonVoicesSlider(juce::Slider::LinearHorizontal, juce::Slider::TextEntryBoxPosition::TextBoxLeft),
+      unisonVoicesAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::UnisonVoices>().data(),
+                             unisonVoicesSlider),
+
+      unisonDetuneSlider(juce::Slider::LinearHorizontal, juce::Slider::TextEntryBoxPosition::TextBoxLeft),
+      unisonDetuneAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::UnisonDetune>().data(),
+                             unisonDetuneSlider),
+
+      unisonSpreadSlider(juce::Slider::LinearHorizontal, juce::Slider::TextEntryBoxPosition::TextBoxLeft),
+      unisonSpreadAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::UnisonSpread>().data(),
+                             unisonSpreadSlider),
+
+      driveTypeComboBox(),
+      driveTypeAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::DriveType>().data(),
+                          driveTypeComboBox),
+
+      driveAmountSlider(juce::Slider::LinearHorizontal, juce::Slider::TextEntryBoxPosition::TextBoxLeft),
+      driveAmountAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::DriveAmount>().data(),
+                            driveAmountSlider),
+
+      noiseTypeComboBox(),
+      noiseTypeAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::NoiseType>().data(),
+                          noiseTypeComboBox),
+
+      noiseLevelSlider(juce::Slider::LinearHorizontal, juce::Slider::TextEntryBoxPosition::TextBoxLeft),
+      noiseLevelAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::NoiseLevel>().data(),
+                           noiseLevelSlider),
+
+      noisePitchModSlider(juce::Slider::LinearHorizontal, juce::Slider::TextEntryBoxPosition::TextBoxLeft),
+      noisePitchModAttachment(p.parameters, magic_enum::enum_name<AvSynthAudioProcessor::Parameters::NoisePitchMod>().data(),
+                              noisePitchModSlider),
+
+      fmComponent(p.parameters),
+
       keyboardComponent(p.keyboardState, juce::MidiKeyboardComponent::horizontalKeyboard),
 
       waveformComponent(p.circularBuffer, p.bufferWritePos),
@@ -36,6 +84,9 @@ AvSynthAudioProcessorEditor::AvSynthAudioProcessorEditor(AvSynthAudioProcessor &
     // Mystisches Bild laden
     loadMysticalImage();
 
+    // Der Hintergrund deckt den ganzen Editor ab
+    setOpaque(true);
+
     juce::ignoreUnused(processorRef);
     // Make sure that before the constructor has finished, you've set the
     // editor's size to whatever you need it to be.
@@ -51,6 +102,30 @@ AvSynthAudioProcessorEditor::AvSynthAudioProcessorEditor(AvSynthAudioProcessor &
         oscTypeComboBox.setSelectedId(oscTypeParam->getIndex() + 1, juce::dontSendNotification);
     }
 
+    auto *driveTypeParam = dynamic_cast<juce::AudioParameterChoice *>(
+        p.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::DriveType>().data()));
+
+    if (driveTypeParam != nullptr) {
+        driveTypeComboBox.clear();
+        auto &choices = driveTypeParam->choices;
+        for (int i = 0; i < choices.size(); ++i) {
+            driveTypeComboBox.addItem(choices[i], i + 1);
+        }
+        driveTypeComboBox.setSelectedId(driveTypeParam->getIndex() + 1, juce::dontSendNotification);
+    }
+
+    auto *noiseTypeParam = dynamic_cast<juce::AudioParameterChoice *>(
+        p.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::NoiseType>().data()));
+
+    if (noiseTypeParam != nullptr) {
+        noiseTypeComboBox.clear();
+        auto &choices = noiseTypeParam->choices;
+        for (int i = 0; i < choices.size(); ++i) {
+            noiseTypeComboBox.addItem(choices[i], i + 1);
+        }
+        noiseTypeComboBox.setSelectedId(noiseTypeParam->getIndex() + 1, juce::dontSendNotification);
+    }
+
     gainSlider.setColour(juce::Slider::thumbColourId, juce::Colour(0xff64b5f6));
     frequencySlider.setColour(juce::Slider::thumbColourId, juce::Colour(0xff64b5f6));
 
@@ -74,6 +149,15 @@ AvSynthAudioProcessorEditor::AvSynthAudioProcessorEditor(AvSynthAudioProcessor &
     // Reverb Component Setup
     setupReverbComponent();
 
+    // Parameter-Listener für ADSR-, Reverb- und Chorus-Component
+    bindParameters();
+
+    // Filterkurve im Spektrum folgt den Cutoff-Parametern
+    lowPassFrequencyValue = processorRef.parameters.getRawParameterValue(
+        magic_enum::enum_name<AvSynthAudioProcessor::Parameters::LowPassFreq>().data());
+    highPassFrequencyValue = processorRef.parameters.getRawParameterValue(
+        magic_enum::enum_name<AvSynthAudioProcessor::Parameters::HighPassFreq>().data());
+
     // Flute Preset Button Setup
     flutePresetButton.setButtonText("Flute Preset");
     flutePresetButton.onClick = [this] { loadFlutePreset(); };
@@ -81,51 +165,29 @@ AvSynthAudioProcessorEditor::AvSynthAudioProcessorEditor(AvSynthAudioProcessor &
     for (const auto component : GetComps()) {
         addAndMakeVisible(component);
     }
-    setSize(800, 900);
+    setSize(800, 1070);
     setResizable(true, true);
 }
 
 // Neue Methode zum Laden des Bildes
 void AvSynthAudioProcessorEditor::loadMysticalImage() {
+    // Das Bild wird im Hintergrund dekodiert; bis dahin wird der Hintergrund ohne Bild gezeichnet
+    mysticalImage = mysticalImageLoader->getImage();
 
-    mysticalImage = juce::ImageCache::getFromMemory(BinaryData::Pan_jpg,
-                                                   BinaryData::Pan_jpgSize);
-
-    if (!mysticalImage.isValid()) {
-        juce::File imageFile = juce::File::getCurrentWorkingDirectory()
-                              .getChildFile("..")
-                              .getChildFile("Resources")
-                              .getChildFile("Pan.jpg");
-
-        if (imageFile.existsAsFile()) {
-            mysticalImage = juce::ImageFileFormat::loadFrom(imageFile);
-        }
-    }
-    // Option 3: Fallback - einfarbiges Bild wenn Laden fehlschlägt
     if (!mysticalImage.isValid()) {
-        // Erstelle ein einfaches Placeholder-Bild mit mystischen Farben
-        mysticalImage = juce::Image(juce::Image::ARGB, 200, 150, true);
-        juce::Graphics g(mysticalImage);
-
-        // Mystischer Verlauf als Fallback
-        auto gradient = juce::ColourGradient(
-            juce::Colour(0xff4a3472), 0, 0,
-            juce::Colour(0xff0a0f1c), 200, 150,
-            false
-        );
-        gradient.addColour(0.5, juce::Colour(0xff64b5f6).withAlpha(0.3f));
-
-        g.setGradientFill(gradient);
-        g.fillAll();
-
-        // Mystische Silhouette als Platzhalter
-        g.setColour(juce::Colour(0xff1a2332).withAlpha(0.7f));
-        juce::Path mysticalShape;
-        mysticalShape.addEllipse(75, 50, 50, 80);
-        g.fillPath(mysticalShape);
+        mysticalImageLoader->addChangeListener(this);
     }
 }
 
+void AvSynthAudioProcessorEditor::changeListenerCallback(juce::ChangeBroadcaster*) {
+    // Dekodiertes Bild übernehmen und den Hintergrund damit neu aufbauen
+    mysticalImage = mysticalImageLoader->getImage();
+    mysticalImageLoader->removeChangeListener(this);
+
+    backgroundCache = {};
+    repaint();
+}
+
 void AvSynthAudioProcessorEditor::setupADSRComponent() {
     // Initiale Werte aus den Parametern laden
     auto attackParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Attack>().data());
@@ -138,43 +200,17 @@ void AvSynthAudioProcessorEditor::setupADSRComponent() {
     if (sustainParam) adsrComponent.setSustain(sustainParam->getValue());
     if (releaseParam) adsrComponent.setRelease(releaseParam->getValue());
 
-    // Callback für Parameter-Änderungen
+    // Callback für Parameter-Änderungen: Werte gesammelt und nur bei Änderung an den Host senden
     adsrComponent.onParameterChanged = [this](float attack, float decay, float sustain, float release) {
-        // Parameter im AudioProcessor aktualisieren
-        auto* attackParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Attack>().data());
-        auto* decayParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Decay>().data());
-        auto* sustainParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Sustain>().data());
-        auto* releaseParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Release>().data());
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(attackParam)) {
-            // Attack: 0.001s - 5s (logarithmisch skaliert)
-            float scaledAttack = 0.001f + attack * attack * 4.999f; // Quadratische Skalierung für bessere Kontrolle
-            floatParam->setValueNotifyingHost(floatParam->convertTo0to1(scaledAttack));
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(decayParam)) {
-            // Decay: 0.001s - 5s
-            float scaledDecay = 0.001f + decay * decay * 4.999f;
-            floatParam->setValueNotifyingHost(floatParam->convertTo0to1(scaledDecay));
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(sustainParam)) {
-            // Sustain: 0.0 - 1.0 (linear)
-            floatParam->setValueNotifyingHost(sustain);
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(releaseParam)) {
-            // Release: 0.001s - 5s
-            float scaledRelease = 0.001f + release * release * 4.999f;
-            floatParam->setValueNotifyingHost(floatParam->convertTo0to1(scaledRelease));
-        }
+        // Zeiten: 0.001s - 5s, quadratische Skalierung für bessere Kontrolle
+        adsrWriter.setValue(0, 0.001f + attack * attack * 4.999f);
+        adsrWriter.setValue(1, 0.001f + decay * decay * 4.999f);
+        // Sustain: 0.0 - 1.0 (linear)
+        adsrWriter.setValue(2, sustain);
+        adsrWriter.setValue(3, 0.001f + release * release * 4.999f);
     };
-
-    // Parameter-Listener hinzufügen um die ADSR-Component zu aktualisieren
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Attack>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Decay>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Sustain>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Release>().data(), this);
+    adsrComponent.onGestureStart = [this] { adsrWriter.beginGesture(); };
+    adsrComponent.onGestureEnd = [this] { adsrWriter.endGesture(); };
 }
 
 void AvSynthAudioProcessorEditor::setupReverbComponent() {
@@ -193,40 +229,14 @@ void AvSynthAudioProcessorEditor::setupReverbComponent() {
 
     // Callback für Parameter-Änderungen
     reverbComponent.onParameterChanged = [this](float roomSize, float damping, float wetLevel, float dryLevel, float width) {
-        // Parameter im AudioProcessor aktualisieren
-        auto* roomSizeParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbRoomSize>().data());
-        auto* dampingParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDamping>().data());
-        auto* wetLevelParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWetLevel>().data());
-        auto* dryLevelParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDryLevel>().data());
-        auto* widthParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWidth>().data());
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(roomSizeParam)) {
-            floatParam->setValueNotifyingHost(roomSize);
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(dampingParam)) {
-            floatParam->setValueNotifyingHost(damping);
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(wetLevelParam)) {
-            floatParam->setValueNotifyingHost(wetLevel);
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(dryLevelParam)) {
-            floatParam->setValueNotifyingHost(dryLevel);
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(widthParam)) {
-            floatParam->setValueNotifyingHost(width);
-        }
+        reverbWriter.setValue(0, roomSize);
+        reverbWriter.setValue(1, damping);
+        reverbWriter.setValue(2, wetLevel);
+        reverbWriter.setValue(3, dryLevel);
+        reverbWriter.setValue(4, width);
     };
-
-    // Parameter-Listener hinzufügen um die Reverb-Component zu aktualisieren
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbRoomSize>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDamping>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWetLevel>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDryLevel>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWidth>().data(), this);
+    reverbComponent.onGestureStart = [this] { reverbWriter.beginGesture(); };
+    reverbComponent.onGestureEnd = [this] { reverbWriter.endGesture(); };
 }
 
 void AvSynthAudioProcessorEditor::setupChorusComponent() {
@@ -243,60 +253,87 @@ void AvSynthAudioProcessorEditor::setupChorusComponent() {
 
     // Callback für Parameter-Änderungen
     chorusComponent.onParameterChanged = [this](float rate, float depth, float feedback, float mix) {
-        // Parameter im AudioProcessor aktualisieren
-        auto* rateParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusRate>().data());
-        auto* depthParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusDepth>().data());
-        auto* feedbackParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusFeedback>().data());
-        auto* mixParam = processorRef.parameters.getParameter(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusMix>().data());
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(rateParam)) {
-            floatParam->setValueNotifyingHost(floatParam->convertTo0to1(rate));
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(depthParam)) {
-            floatParam->setValueNotifyingHost(depth);
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(feedbackParam)) {
-            floatParam->setValueNotifyingHost(feedback);
-        }
-
-        if (auto* floatParam = dynamic_cast<juce::AudioParameterFloat*>(mixParam)) {
-            floatParam->setValueNotifyingHost(mix);
-        }
+        chorusWriter.setValue(0, rate);
+        chorusWriter.setValue(1, depth);
+        chorusWriter.setValue(2, feedback);
+        chorusWriter.setValue(3, mix);
     };
-
-    // Parameter-Listener hinzufügen um die Chorus-Component zu aktualisieren
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusRate>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusDepth>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusFeedback>().data(), this);
-    processorRef.parameters.addParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusMix>().data(), this);
+    chorusComponent.onGestureStart = [this] { chorusWriter.beginGesture(); };
+    chorusComponent.onGestureEnd = [this] { chorusWriter.endGesture(); };
 }
 
 AvSynthAudioProcessorEditor::~AvSynthAudioProcessorEditor() {
 
     setLookAndFeel(nullptr);
-    // Parameter-Listener entfernen
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Attack>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Decay>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Sustain>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Release>().data(), this);
-
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbRoomSize>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDamping>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWetLevel>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDryLevel>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWidth>().data(), this);
-
-    // Chorus Parameter-Listener entfernen
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusRate>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusDepth>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusFeedback>().data(), this);
-    processorRef.parameters.removeParameterListener(magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusMix>().data(), this);
+    mysticalImageLoader->removeChangeListener(this);
+
+    // Parameter-Listener entfernen und ausstehende Aktualisierungen verwerfen
+    for (auto* parameter : boundParameters) {
+        if (parameter != nullptr) {
+            parameter->removeListener(this);
+        }
+    }
+    cancelPendingUpdate();
 }
 
 //==============================================================================
 void AvSynthAudioProcessorEditor::paint(juce::Graphics &g) {
+    if (getWidth() <= 0 || getHeight() <= 0) return;
+
+    // Hintergrund nur bei Größen- oder Skalierungsänderung neu aufbauen
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!backgroundCache.isValid() || !juce::approximatelyEqual(scale, backgroundCacheScale)) {
+        updateBackgroundCache(scale);
+    }
+
+    g.drawImage(backgroundCache, getLocalBounds().toFloat());
+}
+
+#if JUCE_DEBUG
+// Debug-Anzeige der aktuellen Qualitätsstufe und der gemessenen Zeichenlast
+void AvSynthAudioProcessorEditor::paintOverChildren(juce::Graphics &g) {
+    const auto area = getQualityOverlayBounds();
+
+    g.setColour(juce::Colours::black.withAlpha(0.6f));
+    g.fillRect(area);
+
+    g.setColour(juce::Colours::white);
+    g.setFont(12.0f);
+    g.drawText("Quality: " + qualityGovernor->getLevelName() + "  Paint load: " +
+                   juce::String(qualityGovernor->getPaintLoad() * 100.0, 1) + " %",
+               area, juce::Justification::centred);
+}
+#endif
+
+// Die Last ändert sich nur einmal pro Messintervall, nur dann neu zeichnen
+void AvSynthAudioProcessorEditor::updateQualityOverlay() {
+#if JUCE_DEBUG
+    const auto paintLoad = qualityGovernor->getPaintLoad();
+    if (juce::exactlyEqual(paintLoad, shownPaintLoad)) return;
+
+    shownPaintLoad = paintLoad;
+    repaint(getQualityOverlayBounds());
+#endif
+}
+
+juce::Rectangle<int> AvSynthAudioProcessorEditor::getQualityOverlayBounds() const {
+    return getLocalBounds().removeFromBottom(18).removeFromRight(220).reduced(2);
+}
+
+// Rendert den kompletten Hintergrund in der physischen Auflösung in ein Bild
+void AvSynthAudioProcessorEditor::updateBackgroundCache(float scale) {
+    backgroundCache = juce::Image(juce::Image::RGB,
+                                  juce::jmax(1, juce::roundToInt(static_cast<float>(getWidth()) * scale)),
+                                  juce::jmax(1, juce::roundToInt(static_cast<float>(getHeight()) * scale)),
+                                  false);
+    backgroundCacheScale = scale;
+
+    juce::Graphics g(backgroundCache);
+    g.addTransform(juce::AffineTransform::scale(scale));
+    drawBackground(g);
+}
+
+void AvSynthAudioProcessorEditor::drawBackground(juce::Graphics &g) {
     // Mystischer Hintergrund mit mehreren Schichten
     auto area = getLocalBounds().toFloat();
 
@@ -350,6 +387,8 @@ void AvSynthAudioProcessorEditor::drawMysticalImage(juce::Graphics& g) {
 }
 
 void AvSynthAudioProcessorEditor::resized() {
+    // Hintergrund beim nächsten paint() in der neuen Größe aufbauen
+    backgroundCache = {};
 
     const int maxSliderWidth = 400;
     // Labels beschriften
@@ -361,6 +400,14 @@ void AvSynthAudioProcessorEditor::resized() {
     highCutFreqLabel.setText("High Pass", juce::dontSendNotification);
     adsrLabel.setText("ADSR Envelope", juce::dontSendNotification);
     chorusLabel.setText("Chorus Effect", juce::dontSendNotification);
+    unisonVoicesLabel.setText("Unison", juce::dontSendNotification);
+    unisonDetuneLabel.setText("Detune", juce::dontSendNotification);
+    unisonSpreadLabel.setText("Spread", juce::dontSendNotification);
+    driveTypeLabel.setText("Drive", juce::dontSendNotification);
+    driveAmountLabel.setText("Amount", juce::dontSendNotification);
+    noiseTypeLabel.setText("Noise", juce::dontSendNotification);
+    noiseLevelLabel.setText("Level", juce::dontSendNotification);
+    noisePitchModLabel.setText("Jitter", juce::dontSendNotification);
 
 
     auto bounds = getLocalBounds().reduced(10);
@@ -372,10 +419,16 @@ void AvSynthAudioProcessorEditor::resized() {
     auto oscTypeComboBoxArea = bounds.removeFromTop(40);
     auto lowCutFreqArea = bounds.removeFromTop(40);
     auto highCutFreqArea = bounds.removeFromTop(40);
+    auto unisonArea = bounds.removeFromTop(40);
+    auto driveArea = bounds.removeFromTop(40);
+    auto noiseArea = bounds.removeFromTop(40);
 
     // ADSR Section
     auto adsrArea = bounds.removeFromTop(170); // Platz für ADSR Component + Label
 
+    // FM Section
+    auto fmArea = bounds.removeFromTop(130);
+
     // Effects Section - Chorus und Reverb nebeneinander
     auto effectsArea = bounds.removeFromTop(200); // Platz für beide Effects + Labels
     auto chorusArea = effectsArea.removeFromLeft(effectsArea.getWidth() / 2); // Linke Hälfte für Chorus
@@ -401,9 +454,41 @@ void AvSynthAudioProcessorEditor::resized() {
     highCutFreqLabel.setBounds(highCutFreqSlider.getRight() + 10,highCutFreqSlider.getY(),80,highCutFreqSlider.getHeight());
     flutePresetButton.setBounds(presetButtonArea.removeFromLeft(120));
 
+    // Unison controls nebeneinander, jeweils mit Label
+    const int unisonColumnWidth = unisonArea.getWidth() / 3;
+    for (auto [slider, label] : {std::pair{&unisonVoicesSlider, &unisonVoicesLabel},
+                                 std::pair{&unisonDetuneSlider, &unisonDetuneLabel},
+                                 std::pair{&unisonSpreadSlider, &unisonSpreadLabel}}) {
+        auto column = unisonArea.removeFromLeft(unisonColumnWidth);
+        label->setBounds(column.removeFromRight(60));
+        slider->setBounds(column);
+    }
+
+    // Drive: Kurvenauswahl links, Stärke rechts
+    auto driveTypeColumn = driveArea.removeFromLeft(driveArea.getWidth() / 3);
+    driveTypeLabel.setBounds(driveTypeColumn.removeFromRight(60));
+    driveTypeComboBox.setBounds(driveTypeColumn.reduced(0, 5));
+    driveAmountLabel.setBounds(driveArea.removeFromRight(60));
+    driveAmountSlider.setBounds(driveArea);
+
+    // Noise: Farbe, Pegel und Tonhöhen-Jitter nebeneinander
+    const int noiseColumnWidth = noiseArea.getWidth() / 3;
+    auto noiseTypeColumn = noiseArea.removeFromLeft(noiseColumnWidth);
+    noiseTypeLabel.setBounds(noiseTypeColumn.removeFromRight(60));
+    noiseTypeComboBox.setBounds(noiseTypeColumn.reduced(0, 5));
+    for (auto [slider, label] : {std::pair{&noiseLevelSlider, &noiseLevelLabel},
+                                 std::pair{&noisePitchModSlider, &noisePitchModLabel}}) {
+        auto column = noiseArea.removeFromLeft(noiseColumnWidth);
+        label->setBounds(column.removeFromRight(60));
+        slider->setBounds(column);
+    }
+
     // ADSR component
     adsrComponent.setBounds(adsrArea);
 
+    // FM component
+    fmComponent.setBounds(fmArea);
+
     // Effects components nebeneinander
     chorusComponent.setBounds(chorusArea);
     reverbComponent.setBounds(reverbArea);
@@ -418,59 +503,139 @@ void AvSynthAudioProcessorEditor::resized() {
 std::vector<juce::Component *> AvSynthAudioProcessorEditor::GetComps() {
     return {&waveformComponent, &spectrumComponent, &spectrumLabel, &gainLabel, &gainSlider, &frequencySlider, &oscTypeComboBox,
             &lowCutFreqSlider, &highCutFreqSlider, &keyboardComponent, &highCutFreqLabel,
-            &frequencyLabel, &oscTypeLabel, &lowCutFreqLabel, &adsrComponent, &adsrLabel, &reverbComponent, &reverbLabel, &flutePresetButton, &chorusComponent, &chorusLabel};
+            &frequencyLabel, &oscTypeLabel, &lowCutFreqLabel, &adsrComponent, &adsrLabel, &reverbComponent, &reverbLabel, &fmComponent, &flutePresetButton, &chorusComponent, &chorusLabel,
+            &unisonVoicesSlider, &unisonDetuneSlider, &unisonSpreadSlider, &unisonVoicesLabel, &unisonDetuneLabel, &unisonSpreadLabel,
+            &driveTypeComboBox, &driveTypeLabel, &driveAmountSlider, &driveAmountLabel,
+            &noiseTypeComboBox, &noiseTypeLabel, &noiseLevelSlider, &noiseLevelLabel, &noisePitchModSlider, &noisePitchModLabel};
 }
 
-// AudioProcessorValueTreeState::Listener implementation
-void AvSynthAudioProcessorEditor::parameterChanged(const juce::String& parameterID, float newValue) {
-    // ADSR Component basierend auf Parameter-Änderungen aktualisieren
-    if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Attack>().data()) {
-        // Rück-Skalierung von Parameter-Wert zu normalisierten Wert (0-1)
-        float normalizedValue = juce::jmap(newValue, 0.001f, 5.0f, 0.0f, 1.0f);
-        normalizedValue = std::sqrt(juce::jlimit(0.0f, 1.0f, normalizedValue)); // Rückgängig quadratische Skalierung
-        adsrComponent.setAttack(normalizedValue);
-    }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Decay>().data()) {
-        float normalizedValue = juce::jmap(newValue, 0.001f, 5.0f, 0.0f, 1.0f);
-        normalizedValue = std::sqrt(juce::jlimit(0.0f, 1.0f, normalizedValue));
-        adsrComponent.setDecay(normalizedValue);
-    }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Sustain>().data()) {
-        adsrComponent.setSustain(newValue); // Sustain ist bereits linear 0-1
-    }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::Release>().data()) {
-        float normalizedValue = juce::jmap(newValue, 0.001f, 5.0f, 0.0f, 1.0f);
-        normalizedValue = std::sqrt(juce::jlimit(0.0f, 1.0f, normalizedValue));
-        adsrComponent.setRelease(normalizedValue);
-    }
-    // Reverb Component basierend auf Parameter-Änderungen aktualisieren
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbRoomSize>().data()) {
-        reverbComponent.setRoomSize(newValue);
-    }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDamping>().data()) {
-        reverbComponent.setDamping(newValue);
+// Dispatch-Tabelle: Parameter -> Aktualisierung der zugehörigen Component
+const std::array<AvSynthAudioProcessorEditor::ParameterBinding, AvSynthAudioProcessorEditor::numBoundParameters>
+    AvSynthAudioProcessorEditor::parameterBindings = {{
+        // ADSR: Rück-Skalierung von Sekunden zum normalisierten Wert (0-1)
+        {AvSynthAudioProcessor::Parameters::Attack,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.adsrComponent.setAttack(envelopeTimeToNormalized(v)); }},
+        {AvSynthAudioProcessor::Parameters::Decay,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.adsrComponent.setDecay(envelopeTimeToNormalized(v)); }},
+        {AvSynthAudioProcessor::Parameters::Sustain,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.adsrComponent.setSustain(v); }}, // Sustain ist bereits linear 0-1
+        {AvSynthAudioProcessor::Parameters::Release,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.adsrComponent.setRelease(envelopeTimeToNormalized(v)); }},
+
+        // Reverb
+        {AvSynthAudioProcessor::Parameters::ReverbRoomSize,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.reverbComponent.setRoomSize(v); }},
+        {AvSynthAudioProcessor::Parameters::ReverbDamping,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.reverbComponent.setDamping(v); }},
+        {AvSynthAudioProcessor::Parameters::ReverbWetLevel,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.reverbComponent.setWetLevel(v); }},
+        {AvSynthAudioProcessor::Parameters::ReverbDryLevel,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.reverbComponent.setDryLevel(v); }},
+        {AvSynthAudioProcessor::Parameters::ReverbWidth,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.reverbComponent.setWidth(v); }},
+
+        // Chorus
+        {AvSynthAudioProcessor::Parameters::ChorusRate,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.chorusComponent.setRate(v); }},
+        {AvSynthAudioProcessor::Parameters::ChorusDepth,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.chorusComponent.setDepth(v); }},
+        {AvSynthAudioProcessor::Parameters::ChorusFeedback,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.chorusComponent.setFeedback(v); }},
+        {AvSynthAudioProcessor::Parameters::ChorusMix,
+         [](AvSynthAudioProcessorEditor& e, float v) { e.chorusComponent.setMix(v); }},
+    }};
+
+float AvSynthAudioProcessorEditor::envelopeTimeToNormalized(float seconds) {
+    float normalizedValue = juce::jmap(seconds, 0.001f, 5.0f, 0.0f, 1.0f);
+    return std::sqrt(juce::jlimit(0.0f, 1.0f, normalizedValue)); // Rückgängig quadratische Skalierung
+}
+
+void AvSynthAudioProcessorEditor::bindParameters() {
+    const auto& processorParameters = processorRef.getParameters();
+    bindingSlots.assign(static_cast<size_t>(processorParameters.size()), -1);
+
+    for (size_t slot = 0; slot < parameterBindings.size(); ++slot) {
+        auto* parameter = processorRef.parameters.getParameter(magic_enum::enum_name(parameterBindings[slot].parameter).data());
+        jassert(parameter != nullptr);
+        if (parameter == nullptr) {
+            continue;
+        }
+
+        // Parameter-Index -> Slot, damit der Listener ohne String-Vergleiche auskommt
+        boundParameters[slot] = parameter;
+        bindingSlots[static_cast<size_t>(parameter->getParameterIndex())] = static_cast<int>(slot);
+        parameter->addListener(this);
     }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWetLevel>().data()) {
-        reverbComponent.setWetLevel(newValue);
+}
+
+// AudioProcessorParameter::Listener implementation
+void AvSynthAudioProcessorEditor::parameterValueChanged(int parameterIndex, float) {
+    // Kann auf jedem Thread aufgerufen werden (auch im Audio-Thread): nur markieren, die Components
+    // werden gesammelt im Message-Thread aktualisiert
+    if (parameterIndex < 0 || parameterIndex >= static_cast<int>(bindingSlots.size())) {
+        return;
     }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbDryLevel>().data()) {
-        reverbComponent.setDryLevel(newValue);
+
+    const auto slot = bindingSlots[static_cast<size_t>(parameterIndex)];
+    if (slot < 0) {
+        return;
     }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ReverbWidth>().data()) {
-        reverbComponent.setWidth(newValue);
-    }// Chorus Component basierend auf Parameter-Änderungen aktualisieren
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusRate>().data()) {
-        chorusComponent.setRate(newValue);
+
+    dirtyParameters.fetch_or(1u << slot, std::memory_order_release);
+    triggerAsyncUpdate();
+}
+
+void AvSynthAudioProcessorEditor::parameterGestureChanged(int, bool) {
+    // Gesten ändern keine Werte
+}
+
+void AvSynthAudioProcessorEditor::handleAsyncUpdate() {
+    // Alle seit dem letzten Durchlauf geänderten Parameter auf einmal übernehmen
+    auto dirty = dirtyParameters.exchange(0, std::memory_order_acquire);
+
+    while (dirty != 0) {
+        const auto slot = static_cast<size_t>(std::countr_zero(dirty));
+        dirty &= dirty - 1; // niedrigstes gesetztes Bit löschen
+
+        auto* parameter = boundParameters[slot];
+        parameterBindings[slot].apply(*this, parameter->convertFrom0to1(parameter->getValue()));
     }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusDepth>().data()) {
-        chorusComponent.setDepth(newValue);
+}
+
+void AvSynthAudioProcessorEditor::updateVoiceDisplay() {
+    // Schnappschuss des Audio-Threads lesen; kollidiert er mit einem Schreibvorgang, im nächsten Frame erneut
+    AvSynthAudioProcessor::VoiceState voiceState;
+    if (!processorRef.voiceState.read(voiceState) || voiceState == shownVoiceState) {
+        return;
     }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusFeedback>().data()) {
-        chorusComponent.setFeedback(newValue);
+
+    shownVoiceState = voiceState;
+    adsrComponent.setPlayhead(voiceState.stage, voiceState.level);
+    keyboardComponent.setSoundingNote(voiceState.note);
+}
+
+void AvSynthAudioProcessorEditor::updateFilterResponse() {
+    const auto sampleRate = processorRef.getSampleRate();
+    if (sampleRate <= 0.0 || lowPassFrequencyValue == nullptr || highPassFrequencyValue == nullptr) {
+        return;
     }
-    else if (parameterID == magic_enum::enum_name<AvSynthAudioProcessor::Parameters::ChorusMix>().data()) {
-        chorusComponent.setMix(newValue);
+
+    // Kurve nur neu berechnen, wenn sich die Filter tatsächlich geändert haben
+    const auto lowPassFrequency = lowPassFrequencyValue->load();
+    const auto highPassFrequency = highPassFrequencyValue->load();
+    if (sampleRate == shownFilterSampleRate && lowPassFrequency == shownLowPassFrequency &&
+        highPassFrequency == shownHighPassFrequency) {
+        return;
     }
+
+    shownFilterSampleRate = sampleRate;
+    shownLowPassFrequency = lowPassFrequency;
+    shownHighPassFrequency = highPassFrequency;
+
+    // Eigene Koeffizienten mit demselben Entwurf wie im Audio-Thread, ohne dessen Filter anzufassen
+    const auto highPass = AvSynthAudioProcessor::makeHighPassStages(sampleRate, highPassFrequency);
+    const auto lowPass = AvSynthAudioProcessor::makeLowPassStages(sampleRate, lowPassFrequency);
+    spectrumComponent.setFilterResponse(sampleRate, {highPass[0], highPass[1], lowPass[0], lowPass[1]});
 }
 
 // Flute Preset Methods
@@ -564,7 +729,7 @@ void AvSynthAudioProcessorEditor::loadFlutePreset() {
     auto* oscParam = processorRef.parameters.getParameter(
         magic_enum::enum_name<AvSynthAudioProcessor::Parameters::OscType>().data());
     if (auto* choiceParam = dynamic_cast<juce::AudioParameterChoice*>(oscParam)) {
-        choiceParam->setValueNotifyingHost(choiceParam->convertTo0to1(4)); // Flute = Index 4
+        choiceParam->setValueNotifyingHost(choiceParam->convertTo0to1(static_cast<int>(AvSynthAudioProcessor::OscType::Flute)));
     }
 
     setFlutePreset();        // ADSR
@@ -2,11 +2,15 @@
 
 #include "ADSRComponent.hpp"
 #include "ChorusComponent.hpp"
+#include "FMComponent.hpp"
 #include "PluginProcessor.hpp"
 #include "ReverbComponent.hpp"
 #include "SpectrumComponent.hpp"
+#include "VoiceKeyboardComponent.hpp"
 #include "WaveformComponent.hpp"
+#include "MysticalImageLoader.hpp"
 #include "MysticalLookAndFeel.hpp"
+#include "ParameterWriter.hpp"
 
 /**
  * @file PluginEditor.hpp
@@ -27,10 +31,14 @@
  * a specialized look-and-feel implementation.
  *
  * @inherits juce::AudioProcessorEditor
- * @inherits juce::AudioProcessorValueTreeState::Listener
+ * @inherits juce::AudioProcessorParameter::Listener
+ * @inherits juce::AsyncUpdater
+ * @inherits juce::ChangeListener
  */
 class AvSynthAudioProcessorEditor final : public juce::AudioProcessorEditor,
-                                          public juce::AudioProcessorValueTreeState::Listener {
+                                          public juce::AudioProcessorParameter::Listener,
+                                          private juce::AsyncUpdater,
+                                          private juce::ChangeListener {
 public:
     /**
      * @brief Constructor for the audio processor editor
@@ -55,11 +63,19 @@ public:
      * @brief Paints the editor's background and visual elements
      * @param g Graphics context for drawing operations
      *
-     * Renders the mystical background gradient, draws the Pan image,
-     * and adds subtle glow effects in the corners for atmospheric lighting.
+     * Draws the cached background image, rebuilding it first when the size
+     * or the display scale changed since it was rendered.
      */
     void paint(juce::Graphics &g) override;
 
+#if JUCE_DEBUG
+    /**
+     * @brief Draws the debug overlay with the current visualiser quality level
+     * @param g Graphics context for drawing operations
+     */
+    void paintOverChildren(juce::Graphics &g) override;
+#endif
+
     /**
      * @brief Handles component layout and resizing
      *
@@ -71,14 +87,19 @@ public:
 
     /**
      * @brief Parameter change listener callback
-     * @param parameterID String identifier of the changed parameter
-     * @param newValue New normalized value (0.0-1.0) of the parameter
+     * @param parameterIndex Index of the changed parameter in the processor
+     * @param newValue New normalized value (0.0-1.0) of the parameter (unused)
      *
-     * Updates the corresponding GUI components when parameters change,
-     * ensuring visual synchronization with audio parameter states.
-     * Handles ADSR, Reverb, and Chorus parameter updates with proper scaling.
+     * May be called on any thread, including the audio thread. Only marks the
+     * parameter as dirty and schedules handleAsyncUpdate(), so bursts of
+     * automation result in one component update per message loop cycle.
      */
-    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void parameterValueChanged(int parameterIndex, float newValue) override;
+
+    /**
+     * @brief Parameter gesture listener callback (unused)
+     */
+    void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override;
 
     /**
      * @brief Loads a complete flute preset
@@ -126,13 +147,9 @@ public:
     /**
      * @brief Loads the mystical background image
      *
-     * Attempts to load the Pan.jpg image from multiple sources:
-     * 1. Binary data embedded in the plugin
-     * 2. External file in Resources directory
-     * 3. Fallback procedural gradient if image loading fails
-     *
-     * Ensures the editor always has a mystical background regardless
-     * of file availability.
+     * Takes the Pan image from the shared MysticalImageLoader. If it is still
+     * being decoded, the editor opens without it and picks it up in
+     * changeListenerCallback() once it is ready.
      */
     void loadMysticalImage();
 
@@ -146,6 +163,21 @@ public:
      */
     void drawMysticalImage(juce::Graphics& g);
 
+    /**
+     * @brief Draws the complete editor background
+     * @param g Graphics context for drawing operations
+     *
+     * Renders the mystical background gradient, draws the Pan image,
+     * and adds subtle glow effects in the corners for atmospheric lighting.
+     */
+    void drawBackground(juce::Graphics& g);
+
+    /**
+     * @brief Renders the background into backgroundCache
+     * @param scale Physical pixels per logical pixel of the current display
+     */
+    void updateBackgroundCache(float scale);
+
 private:
     /**
      * @brief Returns a vector of all GUI components for batch operations
@@ -183,6 +215,83 @@ private:
      */
     void setupChorusComponent();
 
+    /**
+     * @brief Registers the editor as listener of all parameters in parameterBindings
+     *
+     * Fills bindingSlots so that parameterValueChanged() finds the slot of a
+     * parameter by its index instead of comparing parameter IDs.
+     */
+    void bindParameters();
+
+    /**
+     * @brief Applies all dirty parameters to their components on the message thread
+     */
+    void handleAsyncUpdate() override;
+
+    /**
+     * @brief Called by the image loader once the Pan image is decoded
+     *
+     * Takes over the image and rebuilds the cached background.
+     */
+    void changeListenerCallback(juce::ChangeBroadcaster* source) override;
+
+    /**
+     * @brief Converts an envelope time to the normalized value shown by the ADSR component
+     * @param seconds Envelope time in seconds (0.001s - 5s)
+     * @return Normalized value (0.0-1.0), inverse of the quadratic scaling
+     */
+    static float envelopeTimeToNormalized(float seconds);
+
+    /**
+     * @brief Shows the voice state published by the processor
+     *
+     * Runs once per display frame and only while the editor is showing.
+     * Moves the ADSR playhead and highlights the sounding key when the state
+     * changed since the last frame.
+     */
+    void updateVoiceDisplay();
+
+    /**
+     * @brief Updates the filter response overlay of the spectrum display
+     *
+     * Runs once per display frame. Designs the filter chain from the cutoff
+     * parameters and the sample rate, using the processor's filter design,
+     * and passes it to the spectrum display only when one of them changed.
+     */
+    void updateFilterResponse();
+
+    /**
+     * @brief Repaints the debug quality overlay after the governor evaluated a new interval
+     *
+     * Does nothing in release builds, which have no overlay.
+     */
+    void updateQualityOverlay();
+
+    /**
+     * @brief Returns the area of the debug quality overlay
+     */
+    juce::Rectangle<int> getQualityOverlayBounds() const;
+
+    //==============================================================================
+    // Parameter Dispatch
+
+    /**
+     * @brief Entry of the parameter dispatch table
+     */
+    struct ParameterBinding {
+        AvSynthAudioProcessor::Parameters parameter;                 ///< Bound parameter
+        void (*apply)(AvSynthAudioProcessorEditor& editor, float value); ///< Pushes the denormalized value to the component
+    };
+
+    static constexpr size_t numBoundParameters = 13; ///< ADSR, Reverb and Chorus parameters
+
+    /// Dispatch table; the position of a binding is its slot and its bit in dirtyParameters
+    static const std::array<ParameterBinding, numBoundParameters> parameterBindings;
+
+    std::array<juce::RangedAudioParameter*, numBoundParameters> boundParameters{}; ///< Parameter of each slot
+    std::vector<int> bindingSlots;              ///< Processor parameter index -> slot, -1 if not bound
+    std::atomic<uint32_t> dirtyParameters{0};   ///< One bit per slot, set by parameterValueChanged()
+
     //==============================================================================
     // Core Components
 
@@ -194,6 +303,10 @@ private:
      */
     AvSynthAudioProcessor &processorRef;
 
+    ParameterWriter adsrWriter;   ///< Writes Attack, Decay, Sustain and Release from the ADSR component
+    ParameterWriter reverbWriter; ///< Writes the Reverb parameters from the reverb component
+    ParameterWriter chorusWriter; ///< Writes the Chorus parameters from the chorus component
+
     //==============================================================================
     // UI Labels
 
@@ -206,6 +319,14 @@ private:
     juce::Label reverbLabel;        ///< Label for the reverb effect section
     juce::Label chorusLabel;        ///< Label for the chorus effect section
     juce::Label spectrumLabel;      ///< Label for the spectrum analyzer
+    juce::Label unisonVoicesLabel;  ///< Label for the unison voice count
+    juce::Label unisonDetuneLabel;  ///< Label for the unison detune
+    juce::Label unisonSpreadLabel;  ///< Label for the unison stereo spread
+    juce::Label driveTypeLabel;     ///< Label for the drive curve selector
+    juce::Label driveAmountLabel;   ///< Label for the drive amount
+    juce::Label noiseTypeLabel;     ///< Label for the noise colour selector
+    juce::Label noiseLevelLabel;    ///< Label for the noise level
+    juce::Label noisePitchModLabel; ///< Label for the random pitch modulation
 
     //==============================================================================
     // Main Controls
@@ -228,6 +349,39 @@ private:
     juce::Slider highCutFreqSlider; ///< High-pass filter frequency control
     juce::AudioProcessorValueTreeState::SliderAttachment highCutFreqAttachment;  ///< Parameter attachment for high-pass filter
 
+    //==============================================================================
+    // Unison Controls
+
+    juce::Slider unisonVoicesSlider; ///< Number of unison copies
+    juce::AudioProcessorValueTreeState::SliderAttachment unisonVoicesAttachment;  ///< Parameter attachment for unison voices
+
+    juce::Slider unisonDetuneSlider; ///< Unison detune spread in cents
+    juce::AudioProcessorValueTreeState::SliderAttachment unisonDetuneAttachment;  ///< Parameter attachment for unison detune
+
+    juce::Slider unisonSpreadSlider; ///< Unison stereo spread
+    juce::AudioProcessorValueTreeState::SliderAttachment unisonSpreadAttachment;  ///< Parameter attachment for unison spread
+
+    //==============================================================================
+    // Drive Controls
+
+    juce::ComboBox driveTypeComboBox; ///< Saturation curve selector
+    juce::AudioProcessorValueTreeState::ComboBoxAttachment driveTypeAttachment;  ///< Parameter attachment for drive curve
+
+    juce::Slider driveAmountSlider;  ///< Saturation input gain in dB
+    juce::AudioProcessorValueTreeState::SliderAttachment driveAmountAttachment;  ///< Parameter attachment for drive amount
+
+    //==============================================================================
+    // Noise Controls
+
+    juce::ComboBox noiseTypeComboBox; ///< Noise colour selector
+    juce::AudioProcessorValueTreeState::ComboBoxAttachment noiseTypeAttachment;  ///< Parameter attachment for noise colour
+
+    juce::Slider noiseLevelSlider;   ///< Noise layer level
+    juce::AudioProcessorValueTreeState::SliderAttachment noiseLevelAttachment;  ///< Parameter attachment for noise level
+
+    juce::Slider noisePitchModSlider; ///< Random pitch modulation depth in cents
+    juce::AudioProcessorValueTreeState::SliderAttachment noisePitchModAttachment;  ///< Parameter attachment for pitch modulation
+
     //==============================================================================
     // Visual and Interactive Components
 
@@ -239,6 +393,19 @@ private:
      */
     juce::Image mysticalImage;
 
+    /// Decodes the Pan image in the background, shared by all open editors
+    juce::SharedResourcePointer<MysticalImageLoader> mysticalImageLoader;
+
+    /**
+     * @brief Pre-rendered editor background
+     *
+     * Gradient, scaled Pan image and corner glows composited at physical
+     * resolution. Invalidated in resized() and rebuilt when the display
+     * scale changes, so repaints caused by the visualisers only blit it.
+     */
+    juce::Image backgroundCache;
+    float backgroundCacheScale = 0.0f; ///< Display scale backgroundCache was rendered for
+
     /**
      * @brief Custom look-and-feel implementation
      *
@@ -247,6 +414,9 @@ private:
      */
     MysticalLookAndFeel mysticalLookAndFeel;
 
+    /// Adapts the visualiser quality to the paint load, shown in the debug overlay
+    juce::SharedResourcePointer<QualityGovernor> qualityGovernor;
+
     //==============================================================================
     // Effect and Envelope Components
 
@@ -274,6 +444,14 @@ private:
      */
     ReverbComponent reverbComponent;
 
+    /**
+     * @brief FM engine control panel
+     *
+     * Algorithm, feedback and per-operator ratio, level and envelope,
+     * attached directly to the parameter tree.
+     */
+    FMComponent fmComponent;
+
     //==============================================================================
     // Preset and Input Components
 
@@ -290,8 +468,9 @@ private:
      *
      * Interactive on-screen keyboard for note input and testing,
      * with custom mystical color scheme matching the overall design.
+     * Highlights the note the synth is currently playing.
      */
-    juce::MidiKeyboardComponent keyboardComponent;
+    VoiceKeyboardComponent keyboardComponent;
 
     //==============================================================================
     // Audio Visualization Components
@@ -312,5 +491,21 @@ private:
      */
     SpectrumComponent spectrumComponent;
 
+    AvSynthAudioProcessor::VoiceState shownVoiceState; ///< Voice state currently on screen
+
+    std::atomic<float>* lowPassFrequencyValue = nullptr;  ///< Raw LowPassFreq parameter value
+    std::atomic<float>* highPassFrequencyValue = nullptr; ///< Raw HighPassFreq parameter value
+    double shownFilterSampleRate = 0.0;                   ///< Sample rate of the shown filter response
+    float shownLowPassFrequency = 0.0f;                   ///< Low-pass cutoff of the shown filter response
+    float shownHighPassFrequency = 0.0f;                  ///< High-pass cutoff of the shown filter response
+    double shownPaintLoad = -1.0;                         ///< Paint load shown by the debug quality overlay
+
+    /// Updates the voice display, the filter response and the quality overlay in sync with the display refresh
+    juce::VBlankAttachment frameAttachment{this, [this] {
+                                               updateVoiceDisplay();
+                                               updateFilterResponse();
+                                               updateQualityOverlay();
+                                           }};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AvSynthAudioProcessorEditor)
 };
\ No newline at end of file
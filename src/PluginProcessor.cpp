@@ -13,6 +13,7 @@
 #include "PluginProcessor.hpp"
 #include "PluginEditor.hpp"
 #include "Utils.hpp"
+#include "FastMath.hpp"
 #include <magic_enum/magic_enum.hpp>
 #include "ChorusEffect.hpp"
 
@@ -57,6 +58,42 @@ AvSynthAudioProcessor::ChainSettings::Get(const juce::AudioProcessorValueTreeSta
     settings.chorusFeedback = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::ChorusFeedback>().data())->load();
     settings.chorusMix = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::ChorusMix>().data())->load();
 
+    // Load Unison parameters
+    settings.unisonVoices = static_cast<int>(
+        parameters.getRawParameterValue(magic_enum::enum_name<Parameters::UnisonVoices>().data())->load());
+    settings.unisonDetune = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::UnisonDetune>().data())->load();
+    settings.unisonSpread = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::UnisonSpread>().data())->load();
+
+    // Load Drive parameters
+    settings.driveType = static_cast<Saturator::Curve>(
+        static_cast<int>(parameters.getRawParameterValue(magic_enum::enum_name<Parameters::DriveType>().data())->load()));
+    settings.driveAmount = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::DriveAmount>().data())->load();
+
+    // Load Noise parameters
+    settings.noiseType = static_cast<NoiseGenerator::Type>(
+        static_cast<int>(parameters.getRawParameterValue(magic_enum::enum_name<Parameters::NoiseType>().data())->load()));
+    settings.noiseLevel = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::NoiseLevel>().data())->load();
+    settings.noisePitchMod = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::NoisePitchMod>().data())->load();
+
+    // Load FM parameters
+    settings.fmAlgorithm = static_cast<int>(
+        parameters.getRawParameterValue(magic_enum::enum_name<Parameters::FMAlgorithm>().data())->load());
+    settings.fmFeedback = parameters.getRawParameterValue(magic_enum::enum_name<Parameters::FMFeedback>().data())->load();
+
+    for (int op = 0; op < FMEngine::numOperators; ++op) {
+        const auto load = [&parameters, op](Parameters op1Parameter) {
+            return parameters.getRawParameterValue(magic_enum::enum_name(getOperatorParameter(op, op1Parameter)).data())->load();
+        };
+
+        auto &opSettings = settings.fmOperators[static_cast<size_t>(op)];
+        opSettings.ratio = load(Parameters::Op1Ratio);
+        opSettings.level = load(Parameters::Op1Level);
+        opSettings.attack = load(Parameters::Op1Attack);
+        opSettings.decay = load(Parameters::Op1Decay);
+        opSettings.sustain = load(Parameters::Op1Sustain);
+        opSettings.release = load(Parameters::Op1Release);
+    }
+
     return settings;
 }
 
@@ -75,12 +112,15 @@ AvSynthAudioProcessor::AvSynthAudioProcessor()
                          .withOutput("Output", juce::AudioChannelSet::stereo(), true)
 #endif
       ) {
+    keyboardState.addListener(this);
 }
 
 /**
  * @brief Destructor for the AvSynthAudioProcessor
  */
-AvSynthAudioProcessor::~AvSynthAudioProcessor() {}
+AvSynthAudioProcessor::~AvSynthAudioProcessor() {
+    keyboardState.removeListener(this);
+}
 
 //==============================================================================
 
@@ -184,46 +224,92 @@ void AvSynthAudioProcessor::changeProgramName(int index, const juce::String &new
  * @param samplesPerBlock Maximum number of samples that will be processed in each block
  */
 void AvSynthAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
-    // Use this method as the place to do any pre-playback
-    // initialisation that you need..
-    juce::ignoreUnused(sampleRate);
-
     previousChainSettings = ChainSettings::Get(parameters);
-    circularBuffer.setSize(1, samplesPerBlock * 4);
 
-    updateAngleDelta(previousChainSettings.frequency);
+    inverseSampleRate = 1.0 / sampleRate;
+    updatePhaseIncrement(previousChainSettings.frequency);
 
     juce::dsp::ProcessSpec spec{};
     spec.sampleRate = sampleRate;
     spec.maximumBlockSize = samplesPerBlock;
     spec.numChannels = 1;
 
+    // The buffers are allocated separately, so they can be freed and restored without touching this state
+    adsr.prepare(sampleRate);
+    chorus.prepare(spec);
+    fmEngine.prepare(sampleRate);
+
+    // Drive processes every output channel, unlike the mono filter chains
+    auto driveSpec = spec;
+    driveSpec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
+    saturator.prepare(driveSpec);
+
+    preparedSpec = spec;
+    allocateBuffers();
+
     leftChain.prepare(spec);
     rightChain.prepare(spec);
 
-    // Prepare reverb
-    reverb.prepare(spec);
+    // The editor reads the visualisation buffer on the message thread, so it is sized here and never freed
+    circularBuffer.setSize(1, juce::jmax(1, samplesPerBlock) * 4);
+    circularBuffer.clear();
+    bufferWritePos = 0;
+
+    // Reverb was created by allocateBuffers()
     updateReverbParameters(previousChainSettings);
 
+    // Smoothed frequency and cutoffs, advanced once per control block
+    frequencySmoother.reset(sampleRate, controlSmoothingTime);
+    frequencySmoother.setCurrentAndTargetValue(previousChainSettings.frequency);
+    lowPassSmoother.reset(sampleRate, controlSmoothingTime);
+    lowPassSmoother.setCurrentAndTargetValue(previousChainSettings.LowPassFreq);
+    highPassSmoother.reset(sampleRate, controlSmoothingTime);
+    highPassSmoother.setCurrentAndTargetValue(previousChainSettings.HighPassFreq);
+
     updateLowPassCoefficients(previousChainSettings.LowPassFreq);
     updateHighPassCoefficients(previousChainSettings.HighPassFreq);
 
-    // Initialize ADSR
-    adsr.setSampleRate(sampleRate);
-
     // Initialize Chorus
-    chorus.prepare(spec);
     updateChorusParameters(previousChainSettings);
+
+    // Initialize Unison
+    unisonOscillator.prepare(sampleRate);
+    unisonOscillator.setVoices(previousChainSettings.unisonVoices, previousChainSettings.unisonDetune,
+                               previousChainSettings.unisonSpread);
+    unisonOscillator.randomisePhases(random);
+
+    // Initialize Noise
+    noiseGenerator.prepare(sampleRate);
+    noiseGenerator.seed(random);
+    oscillatorFrequency = previousChainSettings.frequency;
+
+    // Initialize FM engine
+    updateFMParameters(previousChainSettings);
+
+    // Initialize Drive
+    updateDriveParameters(previousChainSettings);
+
+    // Page in every buffer now instead of on the first note
+    prewarm(samplesPerBlock);
+
+    // Everything was just reset, so start idle until the first note
+    previousSignalChannels = 1;
+    idleHoldSamples = static_cast<int>(idleHoldTime * sampleRate);
+    silentSamples = 0;
+    isIdle = true;
 }
 
 /**
  * @brief Called when audio playback stops
  *
- * This method can be used to free up any spare memory or resources when playback stops.
+ * Returns the DSP arena and the reverb to the system, so stopped or disabled
+ * instances do not hold on to them. prepareToPlay() allocates them again.
  */
 void AvSynthAudioProcessor::releaseResources() {
-    // When playback stops, you can use this as an opportunity to free up any
-    // spare memory, etc.
+    releaseBuffers();
+
+    // Should a host process without preparing again, the idle path keeps the output silent
+    isIdle = true;
 }
 
 /**
@@ -263,117 +349,152 @@ bool AvSynthAudioProcessor::isBusesLayoutSupported(const BusesLayout &layouts) c
  *
  * This is the core method where all audio synthesis and processing occurs. It handles:
  * - MIDI message processing for note on/off events
- * - Oscillator synthesis with frequency smoothing
+ * - Oscillator synthesis with frequency smoothing, in control blocks of 32 samples
+ * - Noise layer and random pitch modulation
  * - ADSR envelope application
- * - Filter processing (high-pass and low-pass)
+ * - Drive/saturation stage
+ * - Filter processing (high-pass and low-pass), with cutoff updates per control block
  * - Chorus and reverb effects
  * - Output gain application
  * - Circular buffer updates for visualization
  *
+ * While idle (no envelope running and all effect tails silent) the block is only cleared.
+ *
  * @param buffer Audio buffer containing the input/output audio data
  * @param midiMessages MIDI messages to be processed for this audio block
  */
 void AvSynthAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer, juce::MidiBuffer &midiMessages) {
-    // Ignore MIDI messages as they're not used in this processor
-    juce::ignoreUnused(midiMessages);
     // Prevent denormalized numbers in audio calculations for better performance
     juce::ScopedNoDenormals noDenormals;
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
 
-    // Merge keyboardComponent MIDI events into midiMessages
-    keyboardState.processNextMidiBuffer(midiMessages, 0, buffer.getNumSamples(), true);
+    // Merge the on-screen keyboard events into midiMessages without taking any lock
+    mergeQueuedMidi(midiMessages, buffer.getNumSamples());
 
     // Get current parameter values
     const auto chainSettings = ChainSettings::Get(parameters);
 
-    // Update ADSR parameters if they have changed
-    adsrParams.attack = chainSettings.attack;
-    adsrParams.decay = chainSettings.decay;
-    adsrParams.sustain = chainSettings.sustain;
-    adsrParams.release = chainSettings.release;
-    adsr.setParameters(adsrParams);
+    // Update ADSR parameters (the envelope ignores unchanged values)
+    adsr.setParameters({chainSettings.attack, chainSettings.decay, chainSettings.sustain, chainSettings.release});
 
-    // Update reverb parameters
-    updateReverbParameters(chainSettings);
+    // The MIDI events are applied at their sample positions while the source is rendered;
+    // a note-on anywhere in the block wakes the processor
+    bool blockHasNoteOn = false;
+    for (const auto metadata : midiMessages) {
+        blockHasNoteOn = blockHasNoteOn || metadata.getMessage().isNoteOn();
+    }
 
-    // Process MIDI messages
-    if (!midiMessages.isEmpty()) {
-        for (const auto &message : midiMessages) {
-            if (message.getMessage().isNoteOn()) {
-                float frequency =
-                    static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(message.getMessage().getNoteNumber()));
-                // Set the frequency based on the MIDI note number
-                auto *freqParam = parameters.getParameter(magic_enum::enum_name<Parameters::Frequency>().data());
-                if (auto *floatParam = dynamic_cast<juce::AudioParameterFloat *>(freqParam)) {
-                    // The value needs to be normalized to the range of 0 to 1 for the parameter
-                    float normValue = floatParam->convertTo0to1(frequency);
-                    floatParam->setValueNotifyingHost(normValue);
-                }
-
-                // Trigger ADSR note on
-                adsr.noteOn();
-                noteIsOn = true;
-                break;
-            }
-            else if (message.getMessage().isNoteOff()) {
-                // Trigger ADSR note off
-                adsr.noteOff();
-                noteIsOn = false;
-            }
+    // Idle short-circuit: nothing is playing and every effect tail has decayed, so the output is silence.
+    // A note-on in this block wakes the processor right here.
+    if (isIdle) {
+        if (!adsr.isActive() && !blockHasNoteOn) {
+            // Nothing to render, but note-offs still have to reach the envelope
+            applyMidiMessages(midiMessages);
+            buffer.clear();
+            previousChainSettings = chainSettings;
+            return;
         }
+
+        // Buffers freed by releaseResources() are only restored by prepareToPlay()
+        if (reverb == nullptr) {
+            applyMidiMessages(midiMessages);
+            buffer.clear();
+            previousChainSettings = chainSettings;
+            return;
+        }
+
+        isIdle = false;
+        silentSamples = 0;
     }
 
-    // Check if the frequency has changed since the last process call
-    if (!juce::approximatelyEqual(previousChainSettings.frequency, chainSettings.frequency)) {
-        // Create a linear ramp to smoothly transition the frequency
-        LinearRamp<float> frequencyRamp;
-        frequencyRamp.reset(previousChainSettings.frequency, chainSettings.frequency, buffer.getNumSamples());
+    // Update reverb parameters (the reverb only exists while the buffers are allocated)
+    updateReverbParameters(chainSettings);
 
-        for (auto sample = 0; sample < buffer.getNumSamples(); ++sample) {
-            auto currentSample = getOscSample(chainSettings.oscType, currentAngle);
-            currentAngle += angleDelta;
-            updateAngleDelta(frequencyRamp.getNext());
+    // Frequency and cutoffs glide towards the parameter values at the control rate
+    frequencySmoother.setTargetValue(chainSettings.frequency);
+    lowPassSmoother.setTargetValue(chainSettings.LowPassFreq);
+    highPassSmoother.setTargetValue(chainSettings.HighPassFreq);
+
+    // Source settings only change between host blocks, so they are applied once here
+    const auto signalChannels = getSignalChannels(chainSettings);
+    if (chainSettings.oscType == OscType::FM) {
+        updateFMParameters(chainSettings);
+    } else if (signalChannels > 1) {
+        unisonOscillator.setVoices(chainSettings.unisonVoices, chainSettings.unisonDetune, chainSettings.unisonSpread);
+    }
+    noiseGenerator.setType(chainSettings.noiseType);
 
-            // Apply ADSR envelope
-            float envelopeValue = adsr.getNextSample();
-            currentSample *= envelopeValue;
+    // The right channel state is stale after mono blocks. Until now the right channel carried the left
+    // signal, so the drive continues from the left history, and the right filters start from silence.
+    if (signalChannels > previousSignalChannels) {
+        saturator.copyChannelState(0, 1);
+        rightChain.reset();
+    }
+    previousSignalChannels = signalChannels;
+
+    // Source, drive and filters only run on the channels that carry distinct signals.
+    // The view refers to the output channels, so it needs no allocation.
+    juce::AudioBuffer<float> signal(buffer.getArrayOfWritePointers(), signalChannels, buffer.getNumSamples());
+
+    // Oscillator, noise and envelope in control blocks of at most controlBlockSize, independent of the host
+    // block size. A control block ends early at a MIDI event, so every event takes effect at its own sample.
+    auto midiEvent = midiMessages.cbegin();
+    for (int start = 0; start < buffer.getNumSamples();) {
+        for (; midiEvent != midiMessages.cend() && (*midiEvent).samplePosition <= start; ++midiEvent) {
+            applyMidiMessage((*midiEvent).getMessage());
+        }
 
-            // Write the current sample to all output channels
-            for (int channel = 0; channel < totalNumOutputChannels; ++channel) {
-                buffer.getWritePointer(channel)[sample] = currentSample;
-            }
+        auto end = juce::jmin(start + controlBlockSize, buffer.getNumSamples());
+        if (midiEvent != midiMessages.cend()) {
+            end = juce::jmin(end, (*midiEvent).samplePosition);
         }
-    } else {
-        // Sample the sine wave at the current sample rate and write the samples to the buffers
-        for (auto sample = 0; sample < buffer.getNumSamples(); ++sample) {
-            auto currentSample = getOscSample(chainSettings.oscType, currentAngle);
-            currentAngle += angleDelta;
 
-            // Apply ADSR envelope
-            float envelopeValue = adsr.getNextSample();
-            currentSample *= envelopeValue;
+        renderControlBlock(signal, start, end - start, chainSettings);
+        start = end;
+    }
 
-            // Write the current sample to all output channels
-            for (int channel = 0; channel < totalNumOutputChannels; ++channel) {
-                buffer.getWritePointer(channel)[sample] = currentSample;
-            }
-        }
+    // Events the host placed beyond the end of the block
+    for (; midiEvent != midiMessages.cend(); ++midiEvent) {
+        applyMidiMessage((*midiEvent).getMessage());
     }
 
-    updateLowPassCoefficients(chainSettings.LowPassFreq);
-    updateHighPassCoefficients(chainSettings.HighPassFreq);
+    // Apply the drive stage before the filters
+    updateDriveParameters(chainSettings);
+    saturator.processBlock(signal);
 
-    // Apply the filters to the audio buffer
-    juce::dsp::AudioBlock<float> block(buffer);
+    // Apply the filters to the signal channels, updating the coefficients once per control block
+    juce::dsp::AudioBlock<float> signalBlock(signal);
+
+    for (int start = 0; start < buffer.getNumSamples(); start += controlBlockSize) {
+        const auto numSamples = juce::jmin(controlBlockSize, buffer.getNumSamples() - start);
 
-    auto leftBlock = block.getSingleChannelBlock(0);
-    auto rightBlock = block.getSingleChannelBlock(1);
+        // Coefficients are only recalculated while a cutoff is actually moving
+        const auto lowPassFrequency = lowPassSmoother.skip(numSamples);
+        if (lowPassFrequency != appliedLowPassFrequency) {
+            updateLowPassCoefficients(lowPassFrequency);
+        }
 
-    juce::dsp::ProcessContextReplacing<float> leftContext(leftBlock);
-    juce::dsp::ProcessContextReplacing<float> rightContext(rightBlock);
+        const auto highPassFrequency = highPassSmoother.skip(numSamples);
+        if (highPassFrequency != appliedHighPassFrequency) {
+            updateHighPassCoefficients(highPassFrequency);
+        }
 
-    leftChain.process(leftContext);
-    rightChain.process(rightContext);
+        auto subBlock = signalBlock.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(numSamples));
+        auto leftBlock = subBlock.getSingleChannelBlock(0);
+        juce::dsp::ProcessContextReplacing<float> leftContext(leftBlock);
+        leftChain.process(leftContext);
+
+        if (signalChannels > 1) {
+            auto rightBlock = subBlock.getSingleChannelBlock(1);
+            juce::dsp::ProcessContextReplacing<float> rightContext(rightBlock);
+            rightChain.process(rightContext);
+        }
+    }
+
+    // Fan the mono signal out to all outputs in front of the stereo effects
+    for (int channel = signalChannels; channel < totalNumOutputChannels; ++channel) {
+        buffer.copyFrom(channel, 0, buffer, 0, 0, buffer.getNumSamples());
+    }
 
     // Update Chorus parameters if they have changed
     updateChorusParameters(chainSettings);
@@ -381,8 +502,9 @@ void AvSynthAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer, juce:
     chorus.processBlock(buffer);
 
     // Apply reverb effect
+    juce::dsp::AudioBlock<float> block(buffer);
     juce::dsp::ProcessContextReplacing<float> reverbContext(block);
-    reverb.process(reverbContext);
+    reverb->process(reverbContext);
 
     if (juce::approximatelyEqual(chainSettings.gain, previousChainSettings.gain)) {
         for (int channel = 0; channel < totalNumOutputChannels; ++channel) {
@@ -396,6 +518,9 @@ void AvSynthAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer, juce:
 
     previousChainSettings = chainSettings;
 
+    updateIdleState(buffer);
+    publishVoiceState();
+
     // Get pointer to the first channel's data (mono processing for simplicity)
     const float *channelData = buffer.getReadPointer(0);
 
@@ -466,16 +591,350 @@ void AvSynthAudioProcessor::setStateInformation(const void *data, int sizeInByte
 }
 
 /**
- * @brief Updates the angular delta for oscillator frequency
+ * @brief Renders oscillator, noise layer and envelope for one control block
  *
- * Calculates the phase increment per sample based on the desired frequency
- * and current sample rate.
+ * The pitch modulation and the smoothed note frequency advance once per call,
+ * and the frequency is ramped linearly across the block, so the modulation
+ * resolution is the control block size regardless of the host block size.
+ *
+ * @param buffer Signal channels of the output buffer (one, or two for the stereo unison)
+ * @param startSample First sample of the control block
+ * @param numSamples Length of the control block (at most controlBlockSize)
+ * @param chainSettings Current parameter values
+ */
+void AvSynthAudioProcessor::renderControlBlock(juce::AudioBuffer<float> &buffer, int startSample, int numSamples,
+                                               const ChainSettings &chainSettings) {
+    const auto numChannels = buffer.getNumChannels();
+
+    // Random pitch modulation from the noise source, ramped over the block like any frequency change
+    const auto startFrequency = oscillatorFrequency;
+    auto endFrequency = frequencySmoother.skip(numSamples);
+    const auto pitchModulation = noiseGenerator.getNextModulationValue(numSamples);
+    if (chainSettings.noisePitchMod > 0.0f) {
+        endFrequency *= std::exp2(pitchModulation * chainSettings.noisePitchMod / 1200.0f);
+    }
+    oscillatorFrequency = endFrequency;
+
+    if (chainSettings.oscType == OscType::FM) {
+        // Render the operators block-wise into the first channel, ramping the frequency over the block
+        fmEngine.render(buffer.getWritePointer(0, startSample), numSamples, startFrequency, endFrequency);
+        updatePhaseIncrement(endFrequency);
+
+        // Copy the mono FM signal to all other channels
+        for (int channel = 1; channel < numChannels; ++channel) {
+            buffer.copyFrom(channel, startSample, buffer, 0, startSample, numSamples);
+        }
+    } else if (chainSettings.unisonVoices > 1 && numChannels > 1) {
+        // Render the detuned copies in stereo, ramping the frequency over the block
+        renderUnison(chainSettings.oscType, buffer.getWritePointer(0, startSample),
+                     buffer.getWritePointer(1, startSample), numSamples, startFrequency, endFrequency);
+        updatePhaseIncrement(endFrequency);
+    }
+    // Check if the frequency has changed since the last control block
+    else if (!juce::approximatelyEqual(startFrequency, endFrequency)) {
+        // Create a linear ramp to smoothly transition the frequency
+        LinearRamp<float> frequencyRamp;
+        frequencyRamp.reset(startFrequency, endFrequency, numSamples);
+
+        for (auto sample = startSample; sample < startSample + numSamples; ++sample) {
+            auto currentSample = getOscSample(chainSettings.oscType, static_cast<float>(oscillatorPhase),
+                                              static_cast<float>(oscillatorBreathPhase));
+            advancePhase();
+            updatePhaseIncrement(frequencyRamp.getNext());
+
+            // Write the current sample to all channels
+            for (int channel = 0; channel < numChannels; ++channel) {
+                buffer.getWritePointer(channel)[sample] = currentSample;
+            }
+        }
+    } else {
+        // Sample the sine wave at the current sample rate and write the samples to the buffers
+        for (auto sample = startSample; sample < startSample + numSamples; ++sample) {
+            auto currentSample = getOscSample(chainSettings.oscType, static_cast<float>(oscillatorPhase),
+                                              static_cast<float>(oscillatorBreathPhase));
+            advancePhase();
+
+            // Write the current sample to all channels
+            for (int channel = 0; channel < numChannels; ++channel) {
+                buffer.getWritePointer(channel)[sample] = currentSample;
+            }
+        }
+    }
+
+    // Mix in the noise layer (mono, identical on all channels)
+    if (chainSettings.noiseType != NoiseGenerator::Type::Off) {
+        // The scratch buffer holds one control block, whatever the host block size
+        noiseGenerator.process(noiseBuffer.getWritePointer(0), numSamples);
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            buffer.addFrom(channel, startSample, noiseBuffer, 0, 0, numSamples, chainSettings.noiseLevel);
+        }
+    }
+
+    // Apply ADSR envelope to oscillator and noise
+    adsr.applyEnvelopeToBuffer(buffer, startSample, numSamples);
+}
+
+/**
+ * @brief Applies one MIDI message to the voice
+ *
+ * A note-on sets the frequency parameter, starts the frequency glide and
+ * retriggers the envelopes. Only a note-off for the sounding note releases it,
+ * so overlapping (legato) notes keep playing.
+ *
+ * @param message MIDI message to apply
+ */
+void AvSynthAudioProcessor::applyMidiMessage(const juce::MidiMessage &message) {
+    if (message.isNoteOn()) {
+        float frequency = static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(message.getNoteNumber()));
+        // Set the frequency based on the MIDI note number
+        auto *freqParam = parameters.getParameter(magic_enum::enum_name<Parameters::Frequency>().data());
+        if (auto *floatParam = dynamic_cast<juce::AudioParameterFloat *>(freqParam)) {
+            // The value needs to be normalized to the range of 0 to 1 for the parameter
+            float normValue = floatParam->convertTo0to1(frequency);
+            floatParam->setValueNotifyingHost(normValue);
+        }
+
+        // The block's parameter snapshot predates this note, so the glide starts here
+        frequencySmoother.setTargetValue(frequency);
+
+        // Start the unison copies at random phases
+        unisonOscillator.randomisePhases(random);
+
+        // Trigger ADSR note on
+        adsr.noteOn();
+        fmEngine.noteOn();
+        noteIsOn = true;
+        currentNote = message.getNoteNumber();
+    } else if (message.isNoteOff() && message.getNoteNumber() == currentNote) {
+        // Trigger ADSR note off
+        adsr.noteOff();
+        fmEngine.noteOff();
+        noteIsOn = false;
+    }
+}
+
+/**
+ * @brief Applies every message of a block at once, for blocks that are not rendered
+ *
+ * @param midiMessages MIDI messages of the block
+ */
+void AvSynthAudioProcessor::applyMidiMessages(const juce::MidiBuffer &midiMessages) {
+    for (const auto metadata : midiMessages) {
+        applyMidiMessage(metadata.getMessage());
+    }
+}
+
+/**
+ * @brief Queues a MIDI message from the message thread for the next audio block
+ *
+ * @param message Short MIDI message
+ */
+void AvSynthAudioProcessor::addMidiEvent(const juce::MidiMessage &message) {
+    midiEventQueue.push(message.getRawData(), message.getRawDataSize(), juce::Time::getMillisecondCounterHiRes());
+}
+
+/**
+ * @brief Forwards on-screen keyboard notes to the audio thread through the event queue
+ */
+void AvSynthAudioProcessor::handleNoteOn(juce::MidiKeyboardState *, int midiChannel, int midiNoteNumber,
+                                         float velocity) {
+    addMidiEvent(juce::MidiMessage::noteOn(midiChannel, midiNoteNumber, velocity));
+}
+
+void AvSynthAudioProcessor::handleNoteOff(juce::MidiKeyboardState *, int midiChannel, int midiNoteNumber,
+                                          float velocity) {
+    addMidiEvent(juce::MidiMessage::noteOff(midiChannel, midiNoteNumber, velocity));
+}
+
+/**
+ * @brief Drains the event queue into the block MIDI buffer (audio thread)
+ *
+ * @param midiMessages Block MIDI buffer to merge into
+ * @param numSamples Length of the block in samples
+ */
+void AvSynthAudioProcessor::mergeQueuedMidi(juce::MidiBuffer &midiMessages, int numSamples) {
+    if (numSamples <= 0) return;
+
+    // The events are placed one block late, at their position within the last block's worth of time
+    const auto samplesPerMillisecond = 0.001 / inverseSampleRate;
+    const auto windowStart = juce::Time::getMillisecondCounterHiRes() - numSamples / samplesPerMillisecond;
+
+    MidiEventQueue<256>::Event event;
+    while (midiEventQueue.pop(event)) {
+        const auto offset = juce::roundToInt((event.timestamp - windowStart) * samplesPerMillisecond);
+        midiMessages.addEvent(event.data.data(), event.size, juce::jlimit(0, numSamples - 1, offset));
+    }
+}
+
+/**
+ * @brief Returns the number of channels that carry distinct signals in front of the chorus
+ *
+ * Oscillator, noise and envelope produce the same signal on every channel, except
+ * for the unison copies spread across the stereo field. Everything up to the
+ * chorus therefore runs on a single channel, which is copied to the other
+ * outputs right before the stereo effects.
+ *
+ * @param chainSettings Current parameter values
+ * @return 2 for the stereo unison, 1 otherwise
+ */
+int AvSynthAudioProcessor::getSignalChannels(const ChainSettings &chainSettings) const {
+    const auto stereoUnison = chainSettings.oscType != OscType::FM && chainSettings.unisonVoices > 1 &&
+                              getTotalNumOutputChannels() > 1;
+    return stereoUnison ? 2 : 1;
+}
+
+/**
+ * @brief Touches every DSP buffer once so the first note runs at steady-state cost
+ *
+ * Freshly allocated memory is only mapped on the first write, so without this
+ * the first note would take the page faults of every delay line and reverb
+ * buffer in the middle of an audio block. Silence leaves all states at zero,
+ * but they are reset anyway so that nothing depends on that.
+ *
+ * @param samplesPerBlock Maximum block size passed to prepareToPlay
+ */
+void AvSynthAudioProcessor::prewarm(int samplesPerBlock) {
+    // A host announcing no block size must not stall the loop below
+    const auto blockSize = juce::jmax(1, samplesPerBlock);
+
+    juce::AudioBuffer<float> silence(juce::jmax(1, getTotalNumOutputChannels()), blockSize);
+    juce::dsp::AudioBlock<float> block(silence);
+
+    const auto prewarmSamples = static_cast<int>(std::ceil(prewarmTime / inverseSampleRate));
+
+    for (int done = 0; done < prewarmSamples; done += blockSize) {
+        silence.clear();
+        saturator.processBlock(silence);
+
+        auto leftBlock = block.getSingleChannelBlock(0);
+        juce::dsp::ProcessContextReplacing<float> leftContext(leftBlock);
+        leftChain.process(leftContext);
+
+        if (silence.getNumChannels() > 1) {
+            auto rightBlock = block.getSingleChannelBlock(1);
+            juce::dsp::ProcessContextReplacing<float> rightContext(rightBlock);
+            rightChain.process(rightContext);
+        }
+
+        chorus.processBlock(silence);
+
+        juce::dsp::ProcessContextReplacing<float> reverbContext(block);
+        reverb->process(reverbContext);
+    }
+
+    saturator.reset();
+    leftChain.reset();
+    rightChain.reset();
+    chorus.reset();
+    reverb->reset();
+}
+
+/**
+ * @brief Allocates the DSP arena and the reverb
+ *
+ * Called by prepareToPlay(). The arena comes zeroed and fully paged in.
+ */
+void AvSynthAudioProcessor::allocateBuffers() {
+    const auto samplesPerBlock = static_cast<int>(preparedSpec.maximumBlockSize);
+
+    // Every buffer the audio thread writes lives in one aligned block
+    dspArena.layout([&] {
+        adsr.allocateBuffers(dspArena, samplesPerBlock);
+        chorus.allocateBuffers(dspArena, samplesPerBlock);
+        // The FM operators render one control block at a time, whatever the host block size
+        fmEngine.allocateBuffers(dspArena, controlBlockSize);
+        saturator.allocateBuffers(dspArena, samplesPerBlock);
+
+        if (auto noiseChannel = dspArena.allocate(static_cast<size_t>(controlBlockSize)); !noiseChannel.empty()) {
+            auto *noiseData = noiseChannel.data();
+            noiseBuffer.setDataToReferTo(&noiseData, 1, controlBlockSize);
+        }
+    });
+
+    // The JUCE reverb allocates its comb and all-pass buffers itself
+    reverb = std::make_unique<juce::dsp::Reverb>();
+    reverb->prepare(preparedSpec);
+    reverb->setParameters(reverbParams);
+}
+
+/**
+ * @brief Frees the DSP arena and the reverb
+ *
+ * The components keep their views into the arena, but do not use them before
+ * allocateBuffers() hands out new ones.
+ */
+void AvSynthAudioProcessor::releaseBuffers() {
+    dspArena.release();
+    noiseBuffer.setSize(1, 0);
+    reverb.reset();
+}
+
+/**
+ * @brief Tracks the output level to detect when the processor can go idle
+ *
+ * Once the envelope has finished, the effect tails are watched until the output
+ * stays below the silence threshold for the hold time. The processor then goes
+ * idle and the filter, chorus and reverb states are cleared, so the next note
+ * starts from a clean state.
+ *
+ * @param buffer The fully processed output block
+ */
+void AvSynthAudioProcessor::updateIdleState(const juce::AudioBuffer<float> &buffer) {
+    if (adsr.isActive() || buffer.getMagnitude(0, buffer.getNumSamples()) > silenceThreshold) {
+        silentSamples = 0;
+        return;
+    }
+
+    silentSamples += buffer.getNumSamples();
+
+    if (silentSamples >= idleHoldSamples) {
+        isIdle = true;
+        leftChain.reset();
+        rightChain.reset();
+        chorus.reset();
+        reverb->reset();
+    }
+}
+
+/**
+ * @brief Publishes envelope stage, level and sounding note for the editor
+ */
+void AvSynthAudioProcessor::publishVoiceState() {
+    // Idle blocks return before this point, so the last published state stays Idle until the next note
+    const auto active = adsr.isActive();
+    voiceState.write({adsr.getStage(), active ? adsr.getLevel() : 0.0f, active ? currentNote : -1});
+}
+
+/**
+ * @brief Updates the phase increment for oscillator frequency
+ *
+ * Converts the frequency to cycles per sample using the inverse sample rate
+ * cached in prepareToPlay, so per-sample frequency ramps cost a single multiplication.
  *
  * @param frequency The desired oscillator frequency in Hz
  */
-void AvSynthAudioProcessor::updateAngleDelta(float frequency) {
-    auto cyclesPerSample = frequency / getSampleRate();
-    angleDelta = cyclesPerSample * juce::MathConstants<double>::twoPi;
+void AvSynthAudioProcessor::updatePhaseIncrement(float frequency) {
+    phaseIncrement = frequency * inverseSampleRate;
+}
+
+/**
+ * @brief Advances the oscillator phase by one sample
+ *
+ * Both phases are wrapped to [0, 1) on every step. Their precision therefore
+ * stays the same no matter how long a note is held.
+ */
+void AvSynthAudioProcessor::advancePhase() {
+    oscillatorPhase += phaseIncrement;
+    if (oscillatorPhase >= 1.0) {
+        oscillatorPhase -= 1.0;
+    }
+
+    // The flute breath modulation runs at a tenth of the oscillator frequency
+    oscillatorBreathPhase += phaseIncrement * 0.1;
+    if (oscillatorBreathPhase >= 1.0) {
+        oscillatorBreathPhase -= 1.0;
+    }
 }
 
 /**
@@ -484,21 +943,22 @@ void AvSynthAudioProcessor::updateAngleDelta(float frequency) {
  * Creates a more complex waveform that simulates the harmonic content of a flute
  * by combining a fundamental frequency with characteristic overtones and breath modulation.
  *
- * @param angle The current phase angle for oscillation
+ * @param phase The current oscillator phase in cycles, in [0, 1)
+ * @param breathPhase The current phase of the breath modulation in cycles, in [0, 1)
  * @return float The computed flute waveform sample
  */
-float AvSynthAudioProcessor::getFluteWaveform(double angle) {
+float AvSynthAudioProcessor::getFluteWaveform(float phase, float breathPhase) {
     // Fundamental tone
-    float fundamental = static_cast<float>(std::sin(angle));
+    float fundamental = FastMath::sin2pi(phase);
 
     // Characteristic flute overtones (mainly odd harmonics)
-    float harmonic2 = 0.3f * static_cast<float>(std::sin(2.0 * angle));  // Octave (weak)
-    float harmonic3 = 0.15f * static_cast<float>(std::sin(3.0 * angle)); // Fifth
-    float harmonic4 = 0.05f * static_cast<float>(std::sin(4.0 * angle)); // Double octave (very weak)
-    float harmonic5 = 0.08f * static_cast<float>(std::sin(5.0 * angle)); // Major third above double octave
+    float harmonic2 = 0.3f * FastMath::sin2pi(2.0f * phase);  // Octave (weak)
+    float harmonic3 = 0.15f * FastMath::sin2pi(3.0f * phase); // Fifth
+    float harmonic4 = 0.05f * FastMath::sin2pi(4.0f * phase); // Double octave (very weak)
+    float harmonic5 = 0.08f * FastMath::sin2pi(5.0f * phase); // Major third above double octave
 
     // Light modulation for "breath" effect
-    float breathModulation = 1.0f + 0.02f * static_cast<float>(std::sin(angle * 0.1));
+    float breathModulation = 1.0f + 0.02f * FastMath::sin2pi(breathPhase);
 
     return (fundamental + harmonic2 + harmonic3 + harmonic4 + harmonic5) * breathModulation * 0.8f;
 }
@@ -510,70 +970,225 @@ float AvSynthAudioProcessor::getFluteWaveform(double angle) {
  * sawtooth, triangle, and a custom flute-like waveform.
  *
  * @param type The type of oscillator waveform to generate
- * @param angle The current phase angle for the oscillation
+ * @param phase The current oscillator phase in cycles, in [0, 1)
+ * @param breathPhase The phase of the flute breath modulation in cycles, in [0, 1)
  * @return float The computed sample value
  */
-float AvSynthAudioProcessor::getOscSample(OscType type, double angle) {
+float AvSynthAudioProcessor::getOscSample(OscType type, float phase, float breathPhase) {
     switch (type) {
     case OscType::Sine:
-        return static_cast<float>(std::sin(angle));
+        return FastMath::sin2pi(phase);
     case OscType::Square:
-        return (std::sin(angle) >= 0.0 ? 1.0f : -1.0f);
+        // Positive half of the sine period, no need to evaluate the sine itself
+        return phase < 0.5f ? 1.0f : -1.0f;
     case OscType::Saw:
-        return static_cast<float>(
-            2.0f * (angle / juce::MathConstants<double>::twoPi - std::floor(0.5 + angle / juce::MathConstants<double>::twoPi)));
+        // Rises from 0 to 1, jumps to -1 at half the period and rises back to 0
+        return phase < 0.5f ? 2.0f * phase : 2.0f * phase - 2.0f;
     case OscType::Triangle:
-        return 2.0f * static_cast<float>(std::abs(2.0f * (angle / juce::MathConstants<double>::twoPi -
-                                                          std::floor(0.5 + angle / juce::MathConstants<double>::twoPi)))) -
-               1.0f;
+        return phase < 0.5f ? 4.0f * phase - 1.0f : 3.0f - 4.0f * phase;
     case OscType::Flute:
         // Flute-like waveform with characteristic overtones
-        return getFluteWaveform(angle);
+        return getFluteWaveform(phase, breathPhase);
     default:
         return 0.0f;
     }
 }
 
+/**
+ * @brief Generates one oscillator sample per SIMD lane for a fixed waveform type
+ *
+ * The waveform type is a template parameter so that the unison loop contains no
+ * branches; the discontinuities of square and saw are built from comparison masks.
+ *
+ * @tparam type The type of oscillator waveform to generate
+ * @param phases The oscillator phases in cycles, in [0, 1)
+ * @return juce::dsp::SIMDRegister<float> The computed sample values
+ */
+template <AvSynthAudioProcessor::OscType type>
+juce::dsp::SIMDRegister<float> AvSynthAudioProcessor::getOscSamples(juce::dsp::SIMDRegister<float> phases) {
+    using Register = juce::dsp::SIMDRegister<float>;
+    const auto half = Register::expand(0.5f);
+
+    if constexpr (type == OscType::Sine) {
+        return FastMath::sin2pi(phases);
+    } else if constexpr (type == OscType::Square) {
+        // 1 in the first half of the period, -1 in the second
+        return Register::expand(1.0f) - (Register::expand(2.0f) & Register::greaterThanOrEqual(phases, half));
+    } else if constexpr (type == OscType::Saw) {
+        return phases * 2.0f - (Register::expand(2.0f) & Register::greaterThanOrEqual(phases, half));
+    } else if constexpr (type == OscType::Triangle) {
+        // 1 - 4 * |phase - 0.5|
+        return Register::expand(1.0f) - Register::max(phases - half, half - phases) * 4.0f;
+    } else if constexpr (type == OscType::Flute) {
+        // Same harmonic weights as getFluteWaveform()
+        const auto harmonics = FastMath::sin2pi(phases) + FastMath::sin2pi(phases * 2.0f) * 0.3f +
+                               FastMath::sin2pi(phases * 3.0f) * 0.15f + FastMath::sin2pi(phases * 4.0f) * 0.05f +
+                               FastMath::sin2pi(phases * 5.0f) * 0.08f;
+        return harmonics * 0.8f;
+    } else {
+        return Register::expand(0.0f);
+    }
+}
+
+/**
+ * @brief Renders the stereo unison stack, selecting the waveform once for the whole block
+ *
+ * @param type The type of oscillator waveform to render
+ * @param left Output for the left channel (overwritten)
+ * @param right Output for the right channel (overwritten)
+ * @param numSamples Number of samples to render
+ * @param startFrequency Frequency at the start of the block in Hz
+ * @param endFrequency Frequency at the end of the block in Hz
+ */
+void AvSynthAudioProcessor::renderUnison(OscType type, float *left, float *right, int numSamples, float startFrequency,
+                                         float endFrequency) {
+    using Register = juce::dsp::SIMDRegister<float>;
+
+    switch (type) {
+    case OscType::Sine:
+        unisonOscillator.render([](Register phases) { return getOscSamples<OscType::Sine>(phases); }, left, right,
+                                numSamples, startFrequency, endFrequency);
+        break;
+    case OscType::Square:
+        unisonOscillator.render([](Register phases) { return getOscSamples<OscType::Square>(phases); }, left, right,
+                                numSamples, startFrequency, endFrequency);
+        break;
+    case OscType::Saw:
+        unisonOscillator.render([](Register phases) { return getOscSamples<OscType::Saw>(phases); }, left, right,
+                                numSamples, startFrequency, endFrequency);
+        break;
+    case OscType::Triangle:
+        unisonOscillator.render([](Register phases) { return getOscSamples<OscType::Triangle>(phases); }, left, right,
+                                numSamples, startFrequency, endFrequency);
+        break;
+    case OscType::Flute:
+        unisonOscillator.render([](Register phases) { return getOscSamples<OscType::Flute>(phases); }, left, right,
+                                numSamples, startFrequency, endFrequency);
+        break;
+    default:
+        juce::FloatVectorOperations::clear(left, numSamples);
+        juce::FloatVectorOperations::clear(right, numSamples);
+        break;
+    }
+}
+
+/**
+ * @brief Designs the two biquads of the 4th-order Butterworth high-pass filter
+ *
+ * Shared by the audio thread and the editor's response display, so both use
+ * exactly the same design.
+ *
+ * @param sampleRate Sample rate in Hz
+ * @param frequency Cutoff frequency in Hz
+ * @return Coefficients of both biquads
+ */
+AvSynthAudioProcessor::FilterStages AvSynthAudioProcessor::makeHighPassStages(double sampleRate, float frequency) {
+    return {juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, frequency, butterworthQ[0]),
+            juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, frequency, butterworthQ[1])};
+}
+
+/**
+ * @brief Designs the two biquads of the 4th-order Butterworth low-pass filter
+ *
+ * @param sampleRate Sample rate in Hz
+ * @param frequency Cutoff frequency in Hz
+ * @return Coefficients of both biquads
+ */
+AvSynthAudioProcessor::FilterStages AvSynthAudioProcessor::makeLowPassStages(double sampleRate, float frequency) {
+    return {juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, frequency, butterworthQ[0]),
+            juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, frequency, butterworthQ[1])};
+}
+
 /**
  * @brief Updates the high-pass filter coefficients
  *
  * Recalculates and applies new high-pass filter coefficients to both left and right
- * channel filter chains using a 4th-order Butterworth design.
+ * channel filter chains. The 4th-order Butterworth response is built from two
+ * biquads, written into the existing coefficient objects without allocating.
  *
  * @param frequency The cutoff frequency for the high-pass filter in Hz
  */
 void AvSynthAudioProcessor::updateHighPassCoefficients(float frequency) {
-    auto highPassCoefficients =
-        juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(frequency, getSampleRate(), 4);
+    const auto stages = makeHighPassStages(getSampleRate(), frequency);
 
     auto &leftHighPass = leftChain.get<0>();
-    *leftHighPass.get<0>().coefficients = *highPassCoefficients[0];
-    *leftHighPass.get<1>().coefficients = *highPassCoefficients[1];
+    *leftHighPass.get<0>().coefficients = stages[0];
+    *leftHighPass.get<1>().coefficients = stages[1];
 
     auto &rightHighPass = rightChain.get<0>();
-    *rightHighPass.get<0>().coefficients = *highPassCoefficients[0];
-    *rightHighPass.get<1>().coefficients = *highPassCoefficients[1];
+    *rightHighPass.get<0>().coefficients = stages[0];
+    *rightHighPass.get<1>().coefficients = stages[1];
+
+    appliedHighPassFrequency = frequency;
 }
 
 /**
  * @brief Updates the low-pass filter coefficients
  *
  * Recalculates and applies new low-pass filter coefficients to both left and right
- * channel filter chains using a 4th-order Butterworth design.
+ * channel filter chains. The 4th-order Butterworth response is built from two
+ * biquads, written into the existing coefficient objects without allocating.
  *
  * @param frequency The cutoff frequency for the low-pass filter in Hz
  */
 void AvSynthAudioProcessor::updateLowPassCoefficients(float frequency) {
-    auto lowPassCoefficients =
-        juce::dsp::FilterDesign<float>::designIIRLowpassHighOrderButterworthMethod(frequency, getSampleRate(), 4);
+    const auto stages = makeLowPassStages(getSampleRate(), frequency);
 
     auto &leftLowPass = leftChain.get<1>();
-    *leftLowPass.get<0>().coefficients = *lowPassCoefficients[0];
-    *leftLowPass.get<1>().coefficients = *lowPassCoefficients[1];
+    *leftLowPass.get<0>().coefficients = stages[0];
+    *leftLowPass.get<1>().coefficients = stages[1];
 
     auto &rightLowPass = rightChain.get<1>();
-    *rightLowPass.get<0>().coefficients = *lowPassCoefficients[0];
-    *rightLowPass.get<1>().coefficients = *lowPassCoefficients[1];
+    *rightLowPass.get<0>().coefficients = stages[0];
+    *rightLowPass.get<1>().coefficients = stages[1];
+
+    appliedLowPassFrequency = frequency;
+}
+
+/**
+ * @brief Returns the parameter of an FM operator
+ *
+ * @param operatorIndex Operator index (0 = OP1 to 3 = OP4)
+ * @param op1Parameter Corresponding parameter of operator 1
+ * @return Parameter of the requested operator
+ */
+AvSynthAudioProcessor::Parameters AvSynthAudioProcessor::getOperatorParameter(int operatorIndex,
+                                                                              Parameters op1Parameter) {
+    constexpr auto parametersPerOperator =
+        static_cast<int>(Parameters::Op2Ratio) - static_cast<int>(Parameters::Op1Ratio);
+    static_assert(static_cast<int>(Parameters::Op1Ratio) + FMEngine::numOperators * parametersPerOperator ==
+                  static_cast<int>(Parameters::NumParameters));
+
+    jassert(op1Parameter >= Parameters::Op1Ratio && op1Parameter < Parameters::Op2Ratio);
+    return static_cast<Parameters>(static_cast<int>(op1Parameter) + operatorIndex * parametersPerOperator);
+}
+
+/**
+ * @brief Updates the FM engine parameters
+ *
+ * Applies algorithm, feedback and the settings of every operator from the current chain settings.
+ *
+ * @param settings The current chain settings containing FM parameters
+ */
+void AvSynthAudioProcessor::updateFMParameters(const ChainSettings& settings) {
+    fmEngine.setAlgorithm(settings.fmAlgorithm);
+    fmEngine.setFeedback(settings.fmFeedback);
+
+    for (int op = 0; op < FMEngine::numOperators; ++op) {
+        fmEngine.setOperator(op, settings.fmOperators[static_cast<size_t>(op)]);
+    }
+}
+
+/**
+ * @brief Updates the drive stage parameters
+ *
+ * Applies the saturation curve and drive amount from the current chain settings.
+ *
+ * @param settings The current chain settings containing drive parameters
+ */
+void AvSynthAudioProcessor::updateDriveParameters(const ChainSettings& settings) {
+    saturator.setCurve(settings.driveType);
+    saturator.setDrive(settings.driveAmount);
 }
 
 /**
@@ -600,14 +1215,23 @@ void AvSynthAudioProcessor::updateChorusParameters(const ChainSettings& settings
  * @param settings The current chain settings containing reverb parameters
  */
 void AvSynthAudioProcessor::updateReverbParameters(const ChainSettings& settings) {
-    reverbParams.roomSize = settings.reverbRoomSize;
-    reverbParams.damping = settings.reverbDamping;
-    reverbParams.wetLevel = settings.reverbWetLevel;
-    reverbParams.dryLevel = settings.reverbDryLevel;
-    reverbParams.width = settings.reverbWidth;
-    reverbParams.freezeMode = 0.0f; // Keep this at 0 for normal operation
+    juce::dsp::Reverb::Parameters newParams;
+    newParams.roomSize = settings.reverbRoomSize;
+    newParams.damping = settings.reverbDamping;
+    newParams.wetLevel = settings.reverbWetLevel;
+    newParams.dryLevel = settings.reverbDryLevel;
+    newParams.width = settings.reverbWidth;
+    newParams.freezeMode = 0.0f; // Keep this at 0 for normal operation
+
+    // Reverb::setParameters recalculates all comb and all-pass settings, so skip it when nothing changed
+    if (newParams.roomSize == reverbParams.roomSize && newParams.damping == reverbParams.damping &&
+        newParams.wetLevel == reverbParams.wetLevel && newParams.dryLevel == reverbParams.dryLevel &&
+        newParams.width == reverbParams.width && newParams.freezeMode == reverbParams.freezeMode) {
+        return;
+    }
 
-    reverb.setParameters(reverbParams);
+    reverbParams = newParams;
+    reverb->setParameters(reverbParams);
 }
 
 /**
@@ -638,6 +1262,10 @@ static std::unique_ptr<ParamT> makeParameter(Args &&...args) {
  * - ADSR envelope parameters
  * - Reverb parameters
  * - Chorus parameters
+ * - Unison parameters
+ * - Drive parameters
+ * - Noise parameters
+ * - FM algorithm, feedback and per-operator parameters
  *
  * @return ParameterLayout The complete parameter layout for the processor
  */
@@ -655,10 +1283,13 @@ juce::AudioProcessorValueTreeState::ParameterLayout AvSynthAudioProcessor::creat
     layout.add(makeParameter<juce::AudioParameterFloat, Parameters::LowPassFreq>(
         juce::NormalisableRange(20.0f, 20000.0f, 1.0f, 0.3f), 20000.0f));
 
-    layout.add(makeParameter<juce::AudioParameterChoice, Parameters::OscType>(
-        juce::StringArray{magic_enum::enum_name<OscType::Sine>().data(), magic_enum::enum_name<OscType::Saw>().data(),
-                          magic_enum::enum_name<OscType::Square>().data(), magic_enum::enum_name<OscType::Triangle>().data()},
-        0));
+    // Choices follow the OscType enum order, since the choice index is cast to OscType
+    juce::StringArray oscTypes;
+    for (auto type : magic_enum::enum_values<OscType>()) {
+        if (type != OscType::NumTypes)
+            oscTypes.add(magic_enum::enum_name(type).data());
+    }
+    layout.add(makeParameter<juce::AudioParameterChoice, Parameters::OscType>(oscTypes, 0));
 
     // ADSR Parameters
     layout.add(makeParameter<juce::AudioParameterFloat, Parameters::Attack>(
@@ -702,6 +1333,65 @@ juce::AudioProcessorValueTreeState::ParameterLayout AvSynthAudioProcessor::creat
     layout.add(makeParameter<juce::AudioParameterFloat, Parameters::ChorusMix>(
         juce::NormalisableRange(0.0f, 1.0f, 0.01f), 0.5f));
 
+    // Unison Parameters
+    layout.add(makeParameter<juce::AudioParameterInt, Parameters::UnisonVoices>(1, UnisonOscillator::maxVoices, 1));
+
+    layout.add(makeParameter<juce::AudioParameterFloat, Parameters::UnisonDetune>(
+        juce::NormalisableRange(0.0f, 100.0f, 0.1f), 20.0f));
+
+    layout.add(makeParameter<juce::AudioParameterFloat, Parameters::UnisonSpread>(
+        juce::NormalisableRange(0.0f, 1.0f, 0.01f), 0.5f));
+
+    // Drive Parameters
+    juce::StringArray driveCurves;
+    for (auto curve : magic_enum::enum_values<Saturator::Curve>()) {
+        if (curve != Saturator::Curve::NumCurves)
+            driveCurves.add(magic_enum::enum_name(curve).data());
+    }
+    layout.add(makeParameter<juce::AudioParameterChoice, Parameters::DriveType>(driveCurves, 0));
+
+    layout.add(makeParameter<juce::AudioParameterFloat, Parameters::DriveAmount>(
+        juce::NormalisableRange(0.0f, 36.0f, 0.1f), 12.0f));
+
+    // Noise Parameters
+    juce::StringArray noiseTypes;
+    for (auto type : magic_enum::enum_values<NoiseGenerator::Type>()) {
+        if (type != NoiseGenerator::Type::NumTypes)
+            noiseTypes.add(magic_enum::enum_name(type).data());
+    }
+    layout.add(makeParameter<juce::AudioParameterChoice, Parameters::NoiseType>(noiseTypes, 0));
+
+    layout.add(makeParameter<juce::AudioParameterFloat, Parameters::NoiseLevel>(
+        juce::NormalisableRange(0.0f, 1.0f, 0.01f), 0.2f));
+
+    layout.add(makeParameter<juce::AudioParameterFloat, Parameters::NoisePitchMod>(
+        juce::NormalisableRange(0.0f, 100.0f, 0.1f), 0.0f));
+
+    // FM Parameters
+    layout.add(makeParameter<juce::AudioParameterInt, Parameters::FMAlgorithm>(1, FMEngine::numAlgorithms, 1));
+
+    layout.add(makeParameter<juce::AudioParameterFloat, Parameters::FMFeedback>(
+        juce::NormalisableRange(0.0f, 1.0f, 0.01f), 0.0f));
+
+    // OP1 is the carrier of every algorithm; the modulators start with a mild 2:1 timbre
+    constexpr float defaultRatios[] = {1.0f, 2.0f, 3.0f, 1.0f};
+    constexpr float defaultLevels[] = {1.0f, 0.5f, 0.0f, 0.0f};
+
+    for (int op = 0; op < FMEngine::numOperators; ++op) {
+        const auto addFloat = [&layout, op](Parameters op1Parameter, juce::NormalisableRange<float> range,
+                                            float defaultValue) {
+            const auto *id = magic_enum::enum_name(getOperatorParameter(op, op1Parameter)).data();
+            layout.add(std::make_unique<juce::AudioParameterFloat>(id, id, range, defaultValue));
+        };
+
+        addFloat(Parameters::Op1Ratio, juce::NormalisableRange(0.5f, 16.0f, 0.01f, 0.4f), defaultRatios[op]);
+        addFloat(Parameters::Op1Level, juce::NormalisableRange(0.0f, 1.0f, 0.01f), defaultLevels[op]);
+        addFloat(Parameters::Op1Attack, juce::NormalisableRange(0.001f, 5.0f, 0.001f, 0.3f), 0.01f);
+        addFloat(Parameters::Op1Decay, juce::NormalisableRange(0.001f, 5.0f, 0.001f, 0.3f), 0.3f);
+        addFloat(Parameters::Op1Sustain, juce::NormalisableRange(0.0f, 1.0f, 0.01f), 0.7f);
+        addFloat(Parameters::Op1Release, juce::NormalisableRange(0.001f, 5.0f, 0.001f, 0.3f), 0.3f);
+    }
+
     return layout;
 }
 
@@ -15,6 +15,14 @@
 #include "JuceHeader.h"
 #include "juce_dsp/juce_dsp.h"
 #include "ChorusEffect.hpp"
+#include "UnisonOscillator.hpp"
+#include "Saturator.hpp"
+#include "FMEngine.hpp"
+#include "NoiseGenerator.hpp"
+#include "Envelope.hpp"
+#include "SeqLock.hpp"
+#include "MidiEventQueue.hpp"
+#include "DspArena.hpp"
 
 //==============================================================================
 
@@ -25,8 +33,15 @@
  * This class inherits from juce::AudioProcessor and implements a complete synthesizer
  * with multiple oscillator types, filtering, ADSR envelope, reverb, and chorus effects.
  * It handles MIDI input for note triggering and provides real-time parameter control.
+ *
+ * Notes from the on-screen keyboard and other message-thread sources reach the
+ * audio thread through a lock-free queue, so the audio thread never contends
+ * with the GUI for the MidiKeyboardState lock.
+ *
+ * The large DSP buffers are freed in releaseResources() and restored by prepareToPlay().
  */
-class AvSynthAudioProcessor final : public juce::AudioProcessor {
+class AvSynthAudioProcessor final : public juce::AudioProcessor,
+                                    private juce::MidiKeyboardState::Listener {
     friend class AvSynthAudioProcessorEditor;
 
   public:
@@ -56,6 +71,40 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
         ChorusDepth,      ///< Chorus modulation depth
         ChorusFeedback,   ///< Chorus feedback amount
         ChorusMix,        ///< Chorus wet/dry mix
+        UnisonVoices,     ///< Number of unison oscillator copies
+        UnisonDetune,     ///< Unison detune spread in cents
+        UnisonSpread,     ///< Unison stereo spread
+        DriveType,        ///< Saturation curve
+        DriveAmount,      ///< Saturation input gain in dB
+        NoiseType,        ///< Noise layer colour
+        NoiseLevel,       ///< Noise layer level
+        NoisePitchMod,    ///< Random pitch modulation depth in cents
+        FMAlgorithm,      ///< FM operator algorithm
+        FMFeedback,       ///< FM operator 4 self-feedback
+        Op1Ratio,         ///< FM operator 1 frequency ratio
+        Op1Level,         ///< FM operator 1 output level
+        Op1Attack,        ///< FM operator 1 envelope attack time
+        Op1Decay,         ///< FM operator 1 envelope decay time
+        Op1Sustain,       ///< FM operator 1 envelope sustain level
+        Op1Release,       ///< FM operator 1 envelope release time
+        Op2Ratio,         ///< FM operator 2 frequency ratio
+        Op2Level,         ///< FM operator 2 output level
+        Op2Attack,        ///< FM operator 2 envelope attack time
+        Op2Decay,         ///< FM operator 2 envelope decay time
+        Op2Sustain,       ///< FM operator 2 envelope sustain level
+        Op2Release,       ///< FM operator 2 envelope release time
+        Op3Ratio,         ///< FM operator 3 frequency ratio
+        Op3Level,         ///< FM operator 3 output level
+        Op3Attack,        ///< FM operator 3 envelope attack time
+        Op3Decay,         ///< FM operator 3 envelope decay time
+        Op3Sustain,       ///< FM operator 3 envelope sustain level
+        Op3Release,       ///< FM operator 3 envelope release time
+        Op4Ratio,         ///< FM operator 4 frequency ratio
+        Op4Level,         ///< FM operator 4 output level
+        Op4Attack,        ///< FM operator 4 envelope attack time
+        Op4Decay,         ///< FM operator 4 envelope decay time
+        Op4Sustain,       ///< FM operator 4 envelope sustain level
+        Op4Release,       ///< FM operator 4 envelope release time
         NumParameters     ///< Total number of parameters
     };
 
@@ -71,6 +120,7 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
         Saw,       ///< Sawtooth wave with linear slope
         Triangle,  ///< Triangle wave with linear rise and fall
         Flute,     ///< Custom flute-like waveform with harmonics
+        FM,        ///< Four-operator FM engine
         NumTypes   ///< Total number of oscillator types
     };
 
@@ -107,6 +157,25 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
         float chorusFeedback = 0.3f;  ///< Chorus feedback amount (0.0 to 0.95)
         float chorusMix = 0.5f;       ///< Chorus wet/dry mix (0.0 to 1.0)
 
+        // Unison parameters
+        int unisonVoices = 1;         ///< Number of unison copies (1 to 16)
+        float unisonDetune = 20.0f;   ///< Unison detune spread in cents (0 to 100)
+        float unisonSpread = 0.5f;    ///< Unison stereo spread (0.0 to 1.0)
+
+        // Drive parameters
+        Saturator::Curve driveType = Saturator::Curve::Off; ///< Saturation curve
+        float driveAmount = 12.0f;    ///< Saturation input gain in dB (0 to 36)
+
+        // Noise parameters
+        NoiseGenerator::Type noiseType = NoiseGenerator::Type::Off; ///< Noise layer colour
+        float noiseLevel = 0.2f;      ///< Noise layer level (0.0 to 1.0)
+        float noisePitchMod = 0.0f;   ///< Random pitch modulation depth in cents (0 to 100)
+
+        // FM parameters
+        int fmAlgorithm = 1;          ///< FM operator algorithm (1 to 8)
+        float fmFeedback = 0.0f;      ///< FM operator 4 self-feedback (0.0 to 1.0)
+        std::array<FMEngine::OperatorSettings, FMEngine::numOperators> fmOperators{}; ///< FM operator parameters
+
         /**
          * @brief Static method to extract current parameter values from ValueTreeState
          * @param parameters Reference to the plugin's parameter state
@@ -138,7 +207,7 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 
     /**
-     * @brief Called when audio playback stops to release resources
+     * @brief Called when audio playback stops; returns the large DSP buffers to the system
      */
     void releaseResources() override;
 
@@ -253,25 +322,140 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
     void setStateInformation(const void *data, int sizeInBytes) override;
 
     /**
-     * @brief Updates the angular delta for oscillator frequency changes
+     * @brief Renders oscillator, noise layer and envelope for one control block
+     * @param buffer Output buffer
+     * @param startSample First sample of the control block
+     * @param numSamples Length of the control block
+     * @param chainSettings Current parameter values
+     */
+    void renderControlBlock(juce::AudioBuffer<float> &buffer, int startSample, int numSamples,
+                            const ChainSettings &chainSettings);
+
+    /**
+     * @brief Queues a MIDI message from a non-host source for the next audio block
+     *
+     * Message thread only. The message is merged into the block at the offset
+     * at which it arrived, one block later. Messages longer than three bytes and
+     * messages that do not fit into the full queue are dropped.
+     *
+     * @param message Short MIDI message
+     */
+    void addMidiEvent(const juce::MidiMessage &message);
+
+    /**
+     * @brief Returns the number of channels that carry distinct signals in front of the chorus
+     * @param chainSettings Current parameter values
+     * @return 2 for the stereo unison, 1 otherwise
+     */
+    int getSignalChannels(const ChainSettings &chainSettings) const;
+
+    /**
+     * @brief Touches every DSP buffer once so the first note runs at steady-state cost
+     *
+     * Runs silence through drive, filters, chorus and reverb for prewarmTime.
+     * This pages in every delay line and reverb buffer, and the states are
+     * reset afterwards.
+     *
+     * @param samplesPerBlock Maximum block size passed to prepareToPlay
+     */
+    void prewarm(int samplesPerBlock);
+
+    /**
+     * @brief Allocates the DSP arena and the reverb for preparedSpec
+     *
+     * Only touches buffers, never playback state.
+     */
+    void allocateBuffers();
+
+    /**
+     * @brief Frees the DSP arena and the reverb
+     *
+     * Only called from releaseResources(), while the host does not process.
+     */
+    void releaseBuffers();
+
+    /**
+     * @brief Enters the idle state once the envelope has finished and the output stayed silent
+     * @param buffer Processed output block
+     */
+    void updateIdleState(const juce::AudioBuffer<float> &buffer);
+
+    /**
+     * @brief Publishes the envelope stage, level and sounding note for the editor
+     */
+    void publishVoiceState();
+
+    /**
+     * @brief Updates the phase increment for oscillator frequency changes
      * @param frequency New frequency in Hz
      */
-    void updateAngleDelta(float frequency);
+    void updatePhaseIncrement(float frequency);
+
+    /**
+     * @brief Advances the oscillator and breath phases by one sample and wraps them to [0, 1)
+     */
+    void advancePhase();
 
     /**
      * @brief Generates oscillator samples based on waveform type
      * @param type Oscillator waveform type
-     * @param angle Current phase angle
+     * @param phase Current oscillator phase in cycles [0, 1)
+     * @param breathPhase Current flute breath modulation phase in cycles [0, 1)
      * @return Generated sample value
      */
-    static float getOscSample(OscType type, double angle);
+    static float getOscSample(OscType type, float phase, float breathPhase);
 
     /**
      * @brief Generates flute-like waveform with harmonic content
-     * @param angle Current phase angle
+     * @param phase Current oscillator phase in cycles [0, 1)
+     * @param breathPhase Current breath modulation phase in cycles [0, 1)
      * @return Generated flute sample
      */
-    static float getFluteWaveform(double angle);
+    static float getFluteWaveform(float phase, float breathPhase);
+
+    /**
+     * @brief Generates one oscillator sample per SIMD lane for a fixed waveform type
+     *
+     * Branch-free register counterpart of getOscSample() for the unison copies; the
+     * flute breath modulation is left out because the copies drift against each other anyway.
+     *
+     * @tparam type Oscillator waveform type (any type except FM)
+     * @param phases Oscillator phases in cycles [0, 1), one per lane
+     * @return Generated samples, one per lane
+     */
+    template <OscType type>
+    static juce::dsp::SIMDRegister<float> getOscSamples(juce::dsp::SIMDRegister<float> phases);
+
+    /**
+     * @brief Renders the stereo unison stack, selecting the waveform once for the whole block
+     * @param type Oscillator waveform type
+     * @param left Output for the left channel (overwritten)
+     * @param right Output for the right channel (overwritten)
+     * @param numSamples Number of samples to render
+     * @param startFrequency Frequency at the start of the block in Hz
+     * @param endFrequency Frequency at the end of the block in Hz
+     */
+    void renderUnison(OscType type, float *left, float *right, int numSamples, float startFrequency,
+                      float endFrequency);
+
+    /// Coefficients (b0, b1, b2, a0, a1, a2) of the two biquads forming one 4th-order Butterworth filter
+    using FilterStages = std::array<std::array<float, 6>, 2>;
+
+    /**
+     * @brief Designs the high-pass filter of the filter chain
+     * @param sampleRate Sample rate in Hz
+     * @param frequency Cutoff frequency in Hz
+     * @return Coefficients of both biquads
+     */
+    static FilterStages makeHighPassStages(double sampleRate, float frequency);
+
+    /**
+     * @brief Designs the low-pass filter of the filter chain
+     * @param sampleRate Sample rate in Hz
+     * @param frequency Cutoff frequency in Hz
+     * @return Coefficients of both biquads
+     */
+    static FilterStages makeLowPassStages(double sampleRate, float frequency);
 
     /**
      * @brief Updates high-pass filter coefficients
@@ -291,6 +475,30 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
      */
     void updateReverbParameters(const ChainSettings& settings);
 
+    /**
+     * @brief Returns the parameter of an FM operator
+     *
+     * The six parameters of each operator are consecutive in the Parameters enum,
+     * so the parameter of operator n is found by offsetting the one of operator 1.
+     *
+     * @param operatorIndex Operator index (0 = OP1 to 3 = OP4)
+     * @param op1Parameter Corresponding parameter of operator 1 (Op1Ratio to Op1Release)
+     * @return Parameter of the requested operator
+     */
+    static Parameters getOperatorParameter(int operatorIndex, Parameters op1Parameter);
+
+    /**
+     * @brief Updates FM engine parameters
+     * @param settings Current chain settings containing FM parameters
+     */
+    void updateFMParameters(const ChainSettings& settings);
+
+    /**
+     * @brief Updates drive stage parameters
+     * @param settings Current chain settings containing drive parameters
+     */
+    void updateDriveParameters(const ChainSettings& settings);
+
     /**
      * @brief Updates chorus effect parameters
      * @param settings Current chain settings containing chorus parameters
@@ -308,13 +516,82 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
     /// Audio processor parameter tree state manager
     juce::AudioProcessorValueTreeState parameters{*this, nullptr, "Parameters", createParameterLayout()};
 
-    /// MIDI keyboard state for virtual keyboard input
+    /// MIDI keyboard state for virtual keyboard input; only used on the message thread
     juce::MidiKeyboardState keyboardState;
 
+    /**
+     * @struct VoiceState
+     * @brief What the voice is doing, as shown by the editor
+     *
+     * PanTronic is monophonic, so there is a single voice.
+     */
+    struct VoiceState {
+        Envelope::Stage stage = Envelope::Stage::Idle; ///< Envelope stage
+        float level = 0.0f;                            ///< Envelope level at the end of the last block
+        int note = -1;                                 ///< Sounding MIDI note, -1 while silent
+
+        bool operator==(const VoiceState &other) const = default;
+    };
+
+    /// Voice state after the last block, written by the audio thread without locking
+    SeqLock<VoiceState> voiceState;
+
   private:
-    /// Random number generator for potential future use
+    /**
+     * @brief Queues a note-on from the on-screen keyboard
+     */
+    void handleNoteOn(juce::MidiKeyboardState *source, int midiChannel, int midiNoteNumber, float velocity) override;
+
+    /**
+     * @brief Queues a note-off from the on-screen keyboard
+     */
+    void handleNoteOff(juce::MidiKeyboardState *source, int midiChannel, int midiNoteNumber, float velocity) override;
+
+    /**
+     * @brief Applies one MIDI message to the voice
+     *
+     * Note-on retriggers the voice at the new pitch; note-off releases it if it is the sounding note.
+     *
+     * @param message MIDI message to apply
+     */
+    void applyMidiMessage(const juce::MidiMessage &message);
+
+    /**
+     * @brief Applies every message of a block at once, for blocks that are not rendered
+     * @param midiMessages MIDI messages of the block
+     */
+    void applyMidiMessages(const juce::MidiBuffer &midiMessages);
+
+    /**
+     * @brief Moves the queued non-host MIDI events into the block
+     *
+     * Each event is placed at the offset at which it arrived during the last
+     * block's worth of time, so the relative timing of the events is kept.
+     * Older events are placed at the start of the block.
+     *
+     * @param midiMessages Block MIDI buffer to merge into
+     * @param numSamples Length of the block in samples
+     */
+    void mergeQueuedMidi(juce::MidiBuffer &midiMessages, int numSamples);
+
+    /// MIDI events from the message thread, drained by the audio thread
+    MidiEventQueue<256> midiEventQueue;
+
+    /// Random number generator for unison phase randomisation and noise seeds
     juce::Random random;
 
+    /// Noise source, mixed into the oscillator output and used for random pitch modulation
+    NoiseGenerator noiseGenerator;
+
+    /// Storage of all buffers written on the audio thread, laid out in prepareToPlay
+    DspArena dspArena;
+
+    /// Scratch buffer for one control block of the noise layer, referring to dspArena
+    juce::AudioBuffer<float> noiseBuffer;
+
+    /// Oscillator frequency at the end of the previous block, including pitch modulation
+    float oscillatorFrequency = 440.0f;
+
     /// Previous frame's parameter values for change detection
     ChainSettings previousChainSettings;
 
@@ -334,19 +611,66 @@ class AvSynthAudioProcessor final : public juce::AudioProcessor {
     /// Type alias for complete mono processing chain (high-pass + low-pass)
     using MonoChain = juce::dsp::ProcessorChain<CutFilter, CutFilter>;
 
-    /// Processing chains for left and right channels
+    /// Processing chains for left and right channels; the right one only runs for the stereo unison
     MonoChain leftChain, rightChain;
 
-    /// Current phase angle and phase increment for oscillator
-    double currentAngle = 0.0, angleDelta = 0.0;
+    /// Signal channels of the previous block, to reset the right chain when the signal turns stereo
+    int previousSignalChannels = 1;
+
+    /// Q factors of the two biquads forming a 4th-order Butterworth filter
+    static constexpr float butterworthQ[2] = {0.54119610f, 1.30656296f};
+
+    /// Length of the internal control blocks in samples; modulation and coefficients update at this rate
+    static constexpr int controlBlockSize = 32;
+
+    /// Time in seconds over which frequency and cutoff changes are smoothed
+    static constexpr double controlSmoothingTime = 0.01;
+
+    using FrequencySmoother = juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative>;
+
+    FrequencySmoother frequencySmoother;  ///< Oscillator frequency, glides to the Frequency parameter
+    FrequencySmoother lowPassSmoother;    ///< Low-pass cutoff, glides to the LowPassFreq parameter
+    FrequencySmoother highPassSmoother;   ///< High-pass cutoff, glides to the HighPassFreq parameter
+    float appliedLowPassFrequency = 0.0f;  ///< Cutoff the current low-pass coefficients were designed for
+    float appliedHighPassFrequency = 0.0f; ///< Cutoff the current high-pass coefficients were designed for
+
+    /// Oscillator phase in cycles [0, 1) and phase increment in cycles per sample
+    double oscillatorPhase = 0.0, phaseIncrement = 0.0;
+
+    /// Phase of the flute breath modulation in cycles [0, 1)
+    double oscillatorBreathPhase = 0.0;
+
+    /// Reciprocal of the sample rate, cached in prepareToPlay
+    double inverseSampleRate = 1.0 / 44100.0;
+
+    /// Unison voice stack, used instead of the single oscillator when more than one copy is active
+    UnisonOscillator unisonOscillator;
+
+    /// Four-operator FM engine used by OscType::FM
+    FMEngine fmEngine;
+
+    /// Drive stage between the oscillator and the filters
+    Saturator saturator;
 
     // ADSR Envelope components
-    juce::ADSR adsr;                    ///< ADSR envelope processor
-    juce::ADSR::Parameters adsrParams;  ///< ADSR parameter structure
+    Envelope adsr;                      ///< Block-based exponential ADSR envelope
     bool noteIsOn = false;              ///< Flag indicating if a note is currently pressed
+    int currentNote = -1;               ///< MIDI note of the last note-on, kept through the release
+
+    // Idle detection
+    static constexpr float silenceThreshold = 3.2e-5f; ///< Output level treated as silence (about -90 dB)
+    static constexpr double idleHoldTime = 0.5;        ///< Seconds of silence before going idle
+    int idleHoldSamples = 22050;                       ///< idleHoldTime in samples
+    int silentSamples = 0;                             ///< Consecutive silent samples since the envelope ended
+    bool isIdle = true;                                ///< True while processing is skipped
+
+    /// Silence run through the effects in prepareToPlay; covers the 50 ms chorus delay and the longest reverb comb
+    static constexpr double prewarmTime = 0.1;
+
+    juce::dsp::ProcessSpec preparedSpec{}; ///< Mono spec from prepareToPlay, used to allocate the buffers
 
     // Reverb effect components
-    juce::dsp::Reverb reverb;                    ///< Reverb effect processor
+    std::unique_ptr<juce::dsp::Reverb> reverb;   ///< Reverb effect processor, null while the buffers are released
     juce::dsp::Reverb::Parameters reverbParams; ///< Reverb parameter structure
 
     // Chorus effect component
@@ -0,0 +1,89 @@
+/**
+ * @file QualityGovernor.cpp
+ * @brief Implementation of the QualityGovernor class
+ */
+
+#include "QualityGovernor.hpp"
+
+QualityGovernor::ScopedPaintTimer::ScopedPaintTimer(QualityGovernor& governorToUse)
+    : governor(governorToUse), startTicks(juce::Time::getHighResolutionTicks())
+{
+}
+
+QualityGovernor::ScopedPaintTimer::~ScopedPaintTimer()
+{
+    governor.addPaintTime(juce::Time::getHighResolutionTicks() - startTicks);
+}
+
+int QualityGovernor::getPointStride() const
+{
+    return static_cast<int>(level) + 1;
+}
+
+int QualityGovernor::getTimerInterval() const
+{
+    switch (level)
+    {
+    case Level::High:
+        return 1000 / 60;
+    case Level::Medium:
+        return 1000 / 45;
+    case Level::Low:
+        return 1000 / 30;
+    default:
+        return 1000 / 20;
+    }
+}
+
+juce::String QualityGovernor::getLevelName() const
+{
+    switch (level)
+    {
+    case Level::High:
+        return "High";
+    case Level::Medium:
+        return "Medium";
+    case Level::Low:
+        return "Low";
+    default:
+        return "Minimal";
+    }
+}
+
+void QualityGovernor::addPaintTime(int64_t ticks)
+{
+    const auto now = juce::Time::getHighResolutionTicks();
+
+    if (intervalStart == 0)
+        intervalStart = now - ticks;
+
+    paintTicks += ticks;
+
+    const auto elapsed = juce::Time::highResolutionTicksToSeconds(now - intervalStart);
+    if (elapsed < evaluationInterval)
+        return;
+
+    paintLoad = juce::Time::highResolutionTicksToSeconds(paintTicks) / elapsed;
+    intervalStart = now;
+    paintTicks = 0;
+
+    if (paintLoad > paintBudget)
+    {
+        intervalsWithHeadroom = 0;
+
+        if (level != Level::Minimal)
+            level = static_cast<Level>(static_cast<int>(level) + 1);
+    }
+    else if (paintLoad < paintBudget * headroomRatio)
+    {
+        if (++intervalsWithHeadroom >= intervalsBeforeStepUp && level != Level::High)
+        {
+            level = static_cast<Level>(static_cast<int>(level) - 1);
+            intervalsWithHeadroom = 0;
+        }
+    }
+    else
+    {
+        intervalsWithHeadroom = 0;
+    }
+}
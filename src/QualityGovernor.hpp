@@ -0,0 +1,109 @@
+/**
+ * @file QualityGovernor.hpp
+ * @brief Adaptive drawing quality based on the time spent painting
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class QualityGovernor
+ * @brief Lowers the quality of the visualisers when painting takes too long
+ *
+ * Visualisers time their paint() calls with ScopedPaintTimer. Every
+ * evaluation interval the governor compares the share of wall-clock time
+ * spent painting with a budget. Above the budget it steps one quality level
+ * down; once the load has stayed well below the budget for a few intervals,
+ * it steps back up. The gap between the two thresholds keeps the level from
+ * oscillating.
+ *
+ * Lower levels draw fewer path points, skip the glow effects and lower the
+ * visualiser frame rate. The message thread is shared by all editors, so one
+ * instance is shared through juce::SharedResourcePointer.
+ */
+class QualityGovernor {
+public:
+    /**
+     * @enum Level
+     * @brief Drawing quality, from full quality down
+     */
+    enum class Level {
+        High,   ///< Every point, glows, 60 FPS
+        Medium, ///< Every second point, glows, 45 FPS
+        Low,    ///< Every third point, no glows, 30 FPS
+        Minimal ///< Every fourth point, no glows, 20 FPS
+    };
+
+    /**
+     * @class ScopedPaintTimer
+     * @brief Adds the lifetime of the object to the measured paint time
+     */
+    class ScopedPaintTimer {
+    public:
+        explicit ScopedPaintTimer(QualityGovernor& governorToUse);
+        ~ScopedPaintTimer();
+
+    private:
+        QualityGovernor& governor;
+        int64_t startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedPaintTimer)
+    };
+
+    /**
+     * @brief Returns the current quality level
+     */
+    Level getLevel() const { return level; }
+
+    /**
+     * @brief Returns the paint load measured in the last evaluation interval
+     * @return Share of wall-clock time spent painting (0.0 to 1.0)
+     */
+    double getPaintLoad() const { return paintLoad; }
+
+    /**
+     * @brief Returns how many data points to advance per drawn path point
+     */
+    int getPointStride() const;
+
+    /**
+     * @brief Returns whether glow effects should be drawn
+     */
+    bool shouldDrawGlows() const { return level < Level::Low; }
+
+    /**
+     * @brief Returns the visualiser timer interval in milliseconds
+     */
+    int getTimerInterval() const;
+
+    /**
+     * @brief Returns the name of the current level for the debug overlay
+     */
+    juce::String getLevelName() const;
+
+private:
+    /**
+     * @brief Adds a measured paint and evaluates the load once per interval
+     * @param ticks Duration of the paint in high resolution ticks
+     */
+    void addPaintTime(int64_t ticks);
+
+    /// Share of wall-clock time the visualisers may spend painting (about 4 ms of a 60 FPS frame)
+    static constexpr double paintBudget = 0.25;
+
+    /// Load below which the quality steps back up, as a fraction of the budget
+    static constexpr double headroomRatio = 0.4;
+
+    /// Number of consecutive intervals with headroom before stepping up
+    static constexpr int intervalsBeforeStepUp = 4;
+
+    /// Length of an evaluation interval in seconds
+    static constexpr double evaluationInterval = 0.25;
+
+    Level level = Level::High;    ///< Current quality level
+    double paintLoad = 0.0;       ///< Paint load of the last interval
+    int64_t intervalStart = 0;    ///< Start of the current interval in ticks
+    int64_t paintTicks = 0;       ///< Paint time in the current interval in ticks
+    int intervalsWithHeadroom = 0; ///< Consecutive intervals below the step-up threshold
+};
@@ -27,6 +27,8 @@ ReverbComponent::ReverbComponent()
     roomSizeSlider.setValue(0.5);
     roomSizeSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 60, 20);
     roomSizeSlider.onValueChange = [this] { parameterChanged(); };
+    roomSizeSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    roomSizeSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(roomSizeSlider);
 
     roomSizeLabel.setText("Room Size", juce::dontSendNotification);
@@ -40,6 +42,8 @@ ReverbComponent::ReverbComponent()
     dampingSlider.setValue(0.5);
     dampingSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 60, 20);
     dampingSlider.onValueChange = [this] { parameterChanged(); };
+    dampingSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    dampingSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(dampingSlider);
 
     dampingLabel.setText("Damping", juce::dontSendNotification);
@@ -53,6 +57,8 @@ ReverbComponent::ReverbComponent()
     wetLevelSlider.setValue(0.33);
     wetLevelSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 60, 20);
     wetLevelSlider.onValueChange = [this] { parameterChanged(); };
+    wetLevelSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    wetLevelSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(wetLevelSlider);
 
     wetLevelLabel.setText("Wet Level", juce::dontSendNotification);
@@ -66,6 +72,8 @@ ReverbComponent::ReverbComponent()
     dryLevelSlider.setValue(0.4);
     dryLevelSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 60, 20);
     dryLevelSlider.onValueChange = [this] { parameterChanged(); };
+    dryLevelSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    dryLevelSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(dryLevelSlider);
 
     dryLevelLabel.setText("Dry Level", juce::dontSendNotification);
@@ -79,6 +87,8 @@ ReverbComponent::ReverbComponent()
     widthSlider.setValue(1.0);
     widthSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 60, 20);
     widthSlider.onValueChange = [this] { parameterChanged(); };
+    widthSlider.onDragStart = [this] { if (onGestureStart) onGestureStart(); };
+    widthSlider.onDragEnd = [this] { if (onGestureEnd) onGestureEnd(); };
     addAndMakeVisible(widthSlider);
 
     widthLabel.setText("Width", juce::dontSendNotification);
@@ -122,11 +132,7 @@ void ReverbComponent::paint(juce::Graphics& g) {
     g.fillRoundedRectangle(area.reduced(1), 8.0f);
 
     // Subtle glow effect around the entire component
-    for (float i = 3.0f; i > 0; i -= 0.5f) {
-        auto alpha = (3.0f - i) / 3.0f * 0.08f;
-        g.setColour(juce::Colour(0xff64b5f6).withAlpha(alpha));
-        g.drawRoundedRectangle(area.expanded(i), 8.0f + i, 1.0f);
-    }
+    glowCache->drawGlow(g, area, {juce::Colour(0xff64b5f6), 3.0f, 0.5f, 0.08f, 8.0f, true});
 
     // Main border with mystical glow
     g.setColour(juce::Colour(0xff64b5f6).withAlpha(0.6f));
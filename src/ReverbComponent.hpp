@@ -13,6 +13,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "GlowCache.hpp"
 
 /**
  * @class ReverbComponent
@@ -96,6 +97,16 @@ public:
      */
     std::function<void(float roomSize, float damping, float wetLevel, float dryLevel, float width)> onParameterChanged;
 
+    /**
+     * @brief Called when the user starts dragging one of the knobs
+     */
+    std::function<void()> onGestureStart;
+
+    /**
+     * @brief Called when the user releases a dragged knob
+     */
+    std::function<void()> onGestureEnd;
+
 private:
     /**
      * @brief Internal method called when any parameter changes
@@ -119,5 +130,7 @@ private:
     juce::Label dryLevelLabel;     ///< Label for dry level slider
     juce::Label widthLabel;        ///< Label for width slider
 
+    juce::SharedResourcePointer<GlowCache> glowCache; ///< Shared glow sprites for the outer glow
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReverbComponent)
 };
\ No newline at end of file
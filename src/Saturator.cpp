@@ -0,0 +1,195 @@
+/**
+ * @file Saturator.cpp
+ * @brief Implementation of the Saturator class
+ */
+
+#include "Saturator.hpp"
+#include "FastMath.hpp"
+
+namespace {
+
+/// Bias of the asymmetric curve; shifts the operating point of the tanh
+constexpr float asymmetricBias = 0.3f;
+
+/// tanh(asymmetricBias), subtracted so that the asymmetric curve passes through zero
+const float asymmetricOffset = std::tanh(asymmetricBias);
+
+/**
+ * @brief Smooth saturation: f(x) = tanh(x), F(x) = ln(cosh(x))
+ */
+struct TanhShape {
+    static float apply(float x) { return FastMath::tanh(x); }
+    static float antiderivative(float x) { return FastMath::logCosh(x); }
+};
+
+/**
+ * @brief Hard clipper: f(x) = clamp(x, -1, 1), F(x) = x^2 / 2 inside, |x| - 1/2 outside
+ */
+struct HardClipShape {
+    static float apply(float x) { return x < -1.0f ? -1.0f : (x > 1.0f ? 1.0f : x); }
+
+    static float antiderivative(float x) {
+        const auto magnitude = x < 0.0f ? -x : x;
+        return magnitude <= 1.0f ? 0.5f * x * x : magnitude - 0.5f;
+    }
+};
+
+/**
+ * @brief Triangle wavefolder with period 4: identity on [-1, 1], reflected beyond
+ *
+ * With u = (x + 1) mod 4: f = u - 1 for u <= 2 and 3 - u above, and the periodic
+ * antiderivative G(u) = u^2 / 2 - u resp. 3u - u^2 / 2 - 4 (both zero at u = 0, 2, 4).
+ */
+struct FoldbackShape {
+    static float wrap(float x) {
+        const auto shifted = x + 1.0f;
+        return shifted - 4.0f * FastMath::floor(shifted * 0.25f);
+    }
+
+    static float apply(float x) {
+        const auto u = wrap(x);
+        return u <= 2.0f ? u - 1.0f : 3.0f - u;
+    }
+
+    static float antiderivative(float x) {
+        const auto u = wrap(x);
+        return u <= 2.0f ? 0.5f * u * u - u : 3.0f * u - 0.5f * u * u - 4.0f;
+    }
+};
+
+/**
+ * @brief Asymmetric saturation: f(x) = tanh(x + b) - tanh(b), F(x) = ln(cosh(x + b)) - tanh(b) x
+ *
+ * The resulting DC offset is removed by the high-pass filter that follows the stage.
+ */
+struct AsymmetricShape {
+    static float apply(float x) { return FastMath::tanh(x + asymmetricBias) - asymmetricOffset; }
+
+    static float antiderivative(float x) {
+        return FastMath::logCosh(x + asymmetricBias) - asymmetricOffset * x;
+    }
+};
+
+} // namespace
+
+void Saturator::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    channelStates.assign(spec.numChannels, {});
+}
+
+void Saturator::allocateBuffers(DspArena& arena, int maximumBlockSize)
+{
+    // One extra slot in front of the block holds the previous sample
+    drivenInput = arena.allocate(static_cast<size_t>(maximumBlockSize) + 1);
+    antiderivatives = arena.allocate(static_cast<size_t>(maximumBlockSize) + 1);
+}
+
+void Saturator::reset()
+{
+    for (auto& state : channelStates)
+        state = {};
+}
+
+void Saturator::copyChannelState(int sourceChannel, int destinationChannel)
+{
+    jassert(sourceChannel < static_cast<int>(channelStates.size()));
+    jassert(destinationChannel < static_cast<int>(channelStates.size()));
+
+    channelStates[static_cast<size_t>(destinationChannel)] = channelStates[static_cast<size_t>(sourceChannel)];
+}
+
+void Saturator::setCurve(Curve newCurve)
+{
+    curve = newCurve;
+}
+
+void Saturator::setDrive(float driveDecibels)
+{
+    inputGain = juce::Decibels::decibelsToGain(juce::jlimit(0.0f, 36.0f, driveDecibels));
+    outputGain = 1.0f / std::sqrt(inputGain);
+}
+
+void Saturator::processBlock(juce::AudioBuffer<float>& buffer)
+{
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        processChannel(channel, buffer.getWritePointer(channel), buffer.getNumSamples());
+}
+
+void Saturator::processChannel(int channel, float* samples, int numSamples)
+{
+    jassert(channel < static_cast<int>(channelStates.size()));
+
+    if (curve == Curve::Off)
+    {
+        // Keep the history current, so turning the drive back on does not average against a stale input
+        if (numSamples > 0)
+            channelStates[static_cast<size_t>(channel)].lastInput = samples[numSamples - 1] * inputGain;
+
+        return;
+    }
+
+    // Hosts may send more samples than announced, so the scratch buffers are used in chunks.
+    // processWithShape() carries the last input across the chunks.
+    const auto chunkSize = static_cast<int>(drivenInput.size()) - 1;
+    if (chunkSize <= 0)
+        return;
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const auto chunkLength = juce::jmin(chunkSize, numSamples - start);
+
+        switch (curve)
+        {
+            case Curve::Tanh:
+                processWithShape<TanhShape>(channel, samples + start, chunkLength);
+                break;
+            case Curve::HardClip:
+                processWithShape<HardClipShape>(channel, samples + start, chunkLength);
+                break;
+            case Curve::Foldback:
+                processWithShape<FoldbackShape>(channel, samples + start, chunkLength);
+                break;
+            case Curve::Asymmetric:
+                processWithShape<AsymmetricShape>(channel, samples + start, chunkLength);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+template <typename Shape>
+void Saturator::processWithShape(int channel, float* samples, int numSamples)
+{
+    auto& state = channelStates[static_cast<size_t>(channel)];
+    auto* x = drivenInput.data();
+    auto* F = antiderivatives.data();
+
+    // Pass 1: apply the drive; index 0 holds the last input of the previous block
+    x[0] = state.lastInput;
+    for (int i = 0; i < numSamples; ++i)
+        x[i + 1] = samples[i] * inputGain;
+
+    // Pass 2: antiderivative of every input. F(x[0]) is recomputed so that
+    // switching curves between blocks never mixes two different antiderivatives.
+    for (int i = 0; i <= numSamples; ++i)
+        F[i] = Shape::antiderivative(x[i]);
+
+    // Pass 3: difference quotient. When two inputs are too close the quotient is
+    // ill-conditioned, so the curve is evaluated at the midpoint instead. The
+    // threshold scales with |x| because F is only accurate relative to its magnitude.
+    for (int i = 1; i <= numSamples; ++i)
+    {
+        const auto delta = x[i] - x[i - 1];
+        const auto magnitude = x[i] < 0.0f ? -x[i] : x[i];
+        const auto threshold = 1.0e-3f * (1.0f + magnitude);
+        const auto absDelta = delta < 0.0f ? -delta : delta;
+
+        const auto quotient = (F[i] - F[i - 1]) / (absDelta > threshold ? delta : 1.0f);
+        const auto midpoint = Shape::apply(0.5f * (x[i] + x[i - 1]));
+
+        samples[i - 1] = (absDelta > threshold ? quotient : midpoint) * outputGain;
+    }
+
+    state.lastInput = x[numSamples];
+}
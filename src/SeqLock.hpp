@@ -0,0 +1,83 @@
+/**
+ * @file SeqLock.hpp
+ * @brief Single-writer sequence lock for publishing small structs from the audio thread
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @class SeqLock
+ * @brief Lock-free snapshot of a small trivially copyable value
+ *
+ * The writer (the audio thread) never waits: it bumps a sequence counter to an
+ * odd value, stores the value and bumps the counter to the next even value.
+ * Readers copy the value and retry if the counter was odd or changed meanwhile,
+ * so they only ever see complete snapshots. The value is stored as relaxed
+ * atomic words, which keeps concurrent reads and writes free of data races.
+ *
+ * @tparam T Trivially copyable value type; keep it small, it is copied on every access
+ */
+template <typename T> class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock values are copied word by word");
+
+  public:
+    /**
+     * @brief Publishes a new value (single writer only, wait-free)
+     * @param value Value to publish
+     */
+    void write(const T &value) noexcept {
+        std::array<uint32_t, numWords> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        const auto start = sequence.load(std::memory_order_relaxed);
+        sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < numWords; ++i)
+            data[i].store(words[i], std::memory_order_relaxed);
+
+        sequence.store(start + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reads the latest complete value
+     * @param value Receives the value; left unchanged if reading failed
+     * @return False if every attempt overlapped a write
+     */
+    bool read(T &value) const noexcept {
+        for (int attempt = 0; attempt < maxReadAttempts; ++attempt) {
+            const auto before = sequence.load(std::memory_order_acquire);
+            if ((before & 1u) != 0)
+                continue;
+
+            std::array<uint32_t, numWords> words;
+            for (size_t i = 0; i < numWords; ++i)
+                words[i] = data[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                std::memcpy(&value, words.data(), sizeof(T));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+  private:
+    /// Number of 32-bit words holding the value
+    static constexpr size_t numWords = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    /// Reads give up after this many collisions with the writer and try again next time
+    static constexpr int maxReadAttempts = 4;
+
+    std::atomic<uint32_t> sequence{0};               ///< Even while stable, odd while a write is in progress
+    std::array<std::atomic<uint32_t>, numWords> data{}; ///< The value, split into words
+};
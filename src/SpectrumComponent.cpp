@@ -15,22 +15,16 @@
 /**
  * @brief Constructor implementation for SpectrumComponent
  *
- * Initializes the FFT processor with the specified order, creates a Hann windowing
- * function, zeros out all data buffers, and starts the 60 FPS update timer.
+ * Zeros out the display data. The FFT processor, the windowing function and the
+ * sample buffers are created by startAnalysis() once the component is showing.
  *
  * @param buffer Reference to the audio buffer to analyze
  * @param writePos Reference to the current write position in the buffer
  */
 SpectrumComponent::SpectrumComponent(juce::AudioBuffer<float>& buffer, int& writePos)
-    : audioBuffer(buffer), bufferWritePos(writePos), forwardFFT(fftOrder), window(fftSize, juce::dsp::WindowingFunction<float>::hann)
+    : audioBuffer(buffer), bufferWritePos(writePos)
 {
-    // Initialize arrays
-    juce::zeromem(fifo, sizeof(fifo));
-    juce::zeromem(fftData, sizeof(fftData));
     juce::zeromem(scopeData, sizeof(scopeData));
-
-    // Start timer for regular updates (60 FPS)
-    startTimer(1000 / 60);
 }
 
 /**
@@ -56,6 +50,12 @@ SpectrumComponent::~SpectrumComponent()
  */
 void SpectrumComponent::paint(juce::Graphics& g)
 {
+    // Being painted means being visible again, e.g. after the host window was restored
+    if (!isTimerRunning())
+        updateAnalysisState();
+
+    QualityGovernor::ScopedPaintTimer paintTimer(*governor);
+
     g.fillAll(juce::Colours::black);
 
     // Draw frequency and magnitude scales
@@ -72,7 +72,10 @@ void SpectrumComponent::paint(juce::Graphics& g)
     juce::Path spectrumPath;
     bool pathStarted = false;
 
-    for (int i = 1; i < scopeSize; ++i)
+    // Fewer points when the quality governor has lowered the drawing quality
+    const auto stride = governor->getPointStride();
+
+    for (int i = 1; i < scopeSize; i += stride)
     {
         auto x = juce::jmap(float(i), 0.0f, float(scopeSize), float(area.getX()), float(area.getRight()));
 
@@ -106,6 +109,8 @@ void SpectrumComponent::paint(juce::Graphics& g)
     fillPath.closeSubPath();
 
     g.fillPath(fillPath);
+
+    drawFilterResponse(g);
 }
 
 /**
@@ -119,6 +124,63 @@ void SpectrumComponent::resized()
     // Component resized - nothing specific to do here
 }
 
+void SpectrumComponent::visibilityChanged()
+{
+    updateAnalysisState();
+}
+
+void SpectrumComponent::parentHierarchyChanged()
+{
+    updateAnalysisState();
+}
+
+/**
+ * @brief Matches the analysis state to the visibility of the component
+ *
+ * Minimising the host window does not notify the component, so the timer
+ * callback stops the analysis itself, and paint() (which runs again once the
+ * window is restored) restarts it.
+ */
+void SpectrumComponent::updateAnalysisState()
+{
+    if (isShowing())
+    {
+        if (!isTimerRunning())
+            startAnalysis();
+    }
+    else if (isTimerRunning())
+    {
+        stopAnalysis();
+    }
+}
+
+void SpectrumComponent::startAnalysis()
+{
+    forwardFFT = std::make_unique<juce::dsp::FFT>(fftOrder);
+    window = std::make_unique<juce::dsp::WindowingFunction<float>>(fftSize, juce::dsp::WindowingFunction<float>::hann);
+    fifo.assign(fftSize, 0.0f);
+    fftData.assign(2 * fftSize, 0.0f);
+
+    // Continue from the current audio position instead of catching up on the backlog
+    fifoIndex = 0;
+    nextFFTBlockReady = false;
+    lastReadPos = audioBuffer.getNumSamples() > 0 ? bufferWritePos % audioBuffer.getNumSamples() : 0;
+    firstFrame = true;
+
+    // Start timer for regular updates (60 FPS at full quality)
+    startTimer(governor->getTimerInterval());
+}
+
+void SpectrumComponent::stopAnalysis()
+{
+    stopTimer();
+
+    forwardFFT.reset();
+    window.reset();
+    fifo = {};
+    fftData = {};
+}
+
 /**
  * @brief Timer callback implementation for continuous spectrum updates
  *
@@ -132,6 +194,17 @@ void SpectrumComponent::resized()
  */
 void SpectrumComponent::timerCallback()
 {
+    // Hidden or minimised: release everything until the component is shown again
+    if (!isShowing())
+    {
+        stopAnalysis();
+        return;
+    }
+
+    // Follow the frame rate of the current quality level
+    if (getTimerInterval() != governor->getTimerInterval())
+        startTimer(governor->getTimerInterval());
+
     // Read new audio data from the circular buffer
     if (audioBuffer.getNumSamples() > 0)
     {
@@ -221,10 +294,10 @@ void SpectrumComponent::processFFT()
         fftData[i] = 0.0f;
 
     // Apply windowing function
-    window.multiplyWithWindowingTable(fftData, fftSize);
+    window->multiplyWithWindowingTable(fftData.data(), fftSize);
 
     // Perform FFT
-    forwardFFT.performFrequencyOnlyForwardTransform(fftData);
+    forwardFFT->performFrequencyOnlyForwardTransform(fftData.data());
 
     // Debug: Check FFT output
     float maxFFT = 0.0f;
@@ -302,6 +375,56 @@ void SpectrumComponent::drawFrequencyScale(juce::Graphics& g)
     }
 }
 
+void SpectrumComponent::setFilterResponse(double sampleRate, std::initializer_list<FilterResponse::Coefficients> stages)
+{
+    // Same logarithmic axis as the frequency scale
+    filterResponse.prepare(sampleRate, 20.0f, 20000.0f, responsePoints);
+    filterResponse.compute(stages);
+
+    hasFilterResponse = true;
+    responsePathArea = {};
+    repaint();
+}
+
+/**
+ * @brief Draws the filter response overlay
+ *
+ * The curve is rebuilt from the cached response only when the response or
+ * the component size changed.
+ *
+ * @param g Graphics context for drawing the response
+ */
+void SpectrumComponent::drawFilterResponse(juce::Graphics& g)
+{
+    if (!hasFilterResponse)
+        return;
+
+    auto area = getLocalBounds().reduced(40, 20);
+
+    if (area != responsePathArea)
+    {
+        const auto& magnitudesDb = filterResponse.getMagnitudesDb();
+        responsePath.clear();
+
+        for (size_t i = 0; i < magnitudesDb.size(); ++i)
+        {
+            auto x = juce::jmap(float(i), 0.0f, float(magnitudesDb.size() - 1), float(area.getX()), float(area.getRight()));
+            auto dB = juce::jlimit(responseMinDb, responseMaxDb, magnitudesDb[i]);
+            auto y = juce::jmap(dB, responseMinDb, responseMaxDb, float(area.getBottom()), float(area.getY()));
+
+            if (i == 0)
+                responsePath.startNewSubPath(x, y);
+            else
+                responsePath.lineTo(x, y);
+        }
+
+        responsePathArea = area;
+    }
+
+    g.setColour(juce::Colour(0xffffb74d).withAlpha(0.8f));
+    g.strokePath(responsePath, juce::PathStrokeType(1.5f));
+}
+
 /**
  * @brief Draws the magnitude scale in decibels
  *
@@ -14,6 +14,8 @@
 
 #include "JuceHeader.h"
 #include "juce_dsp/juce_dsp.h"
+#include "FilterResponse.hpp"
+#include "QualityGovernor.hpp"
 
 /**
  * @class SpectrumComponent
@@ -27,14 +29,19 @@
  * - dB magnitude scaling (-100dB to 0dB)
  * - Smoothed spectrum display to reduce flickering
  * - Professional frequency and magnitude grid lines
+ * - Overlay of the filter chain's magnitude response
+ *
+ * Analysis only runs while the component is showing. When it is hidden or the
+ * host window is minimised, the timer stops and the FFT engine and sample
+ * buffers are released; they are rebuilt when the component shows again.
  */
 class SpectrumComponent : public juce::Component, public juce::Timer {
 public:
     /**
      * @brief Constructor for SpectrumComponent
      *
-     * Initializes the FFT analyzer, windowing function, and starts the update timer.
      * Sets up references to the audio buffer for continuous spectrum analysis.
+     * The analyzer itself is created once the component is first showing.
      *
      * @param buffer Reference to the audio buffer to analyze
      * @param writePos Reference to the current write position in the buffer
@@ -70,16 +77,57 @@ public:
      */
     void resized() override;
 
+    /**
+     * @brief Starts or stops the analysis when the component is shown or hidden
+     */
+    void visibilityChanged() override;
+
+    /**
+     * @brief Starts or stops the analysis when the component moves to a shown or hidden parent
+     */
+    void parentHierarchyChanged() override;
+
     /**
      * @brief Timer callback for regular spectrum updates
      *
      * Called at 60 FPS to update the spectrum display. Reads new audio data
      * from the circular buffer, processes it through FFT when enough samples
      * are available, and triggers a repaint when the spectrum data is updated.
+     * Stops the analysis if the component is no longer showing (e.g. the
+     * host window was minimised).
      */
     void timerCallback() override;
 
+    /**
+     * @brief Sets the filter chain shown by the response overlay
+     *
+     * Recomputes the response at the display frequencies. Only call this when
+     * the coefficients changed.
+     *
+     * @param sampleRate Sample rate the coefficients are designed for
+     * @param stages Coefficients of all biquads in the chain
+     */
+    void setFilterResponse(double sampleRate, std::initializer_list<FilterResponse::Coefficients> stages);
+
 private:
+    /**
+     * @brief Starts the analysis if the component is showing, stops it otherwise
+     */
+    void updateAnalysisState();
+
+    /**
+     * @brief Allocates the analyzer and starts reading from the current write position
+     *
+     * Samples written while the analysis was stopped are skipped rather than
+     * replayed, and the display smoothing starts over.
+     */
+    void startAnalysis();
+
+    /**
+     * @brief Stops the update timer and releases the analyzer and sample buffers
+     */
+    void stopAnalysis();
+
     /**
      * @brief Processes audio data through FFT to generate spectrum
      *
@@ -113,22 +161,41 @@ private:
      */
     void drawMagnitudeScale(juce::Graphics& g);
 
+    /**
+     * @brief Draws the filter response overlay
+     *
+     * The response has its own dB range (responseMinDb to responseMaxDb), since
+     * the spectrum scale would squeeze the passband against the top edge.
+     *
+     * @param g Graphics context for drawing the response
+     */
+    void drawFilterResponse(juce::Graphics& g);
+
     // FFT Configuration Constants
     static constexpr int fftOrder = 11;              ///< FFT order (2^11 = 2048 samples)
     static constexpr int fftSize = 1 << fftOrder;    ///< FFT size in samples
     static constexpr int scopeSize = 512;            ///< Number of spectrum display bins
 
-    // FFT Processing Components
-    juce::dsp::FFT forwardFFT;                       ///< Forward FFT processor
-    juce::dsp::WindowingFunction<float> window;      ///< Hann windowing function
+    // FFT Processing Components (only allocated while the analysis runs)
+    std::unique_ptr<juce::dsp::FFT> forwardFFT;                  ///< Forward FFT processor
+    std::unique_ptr<juce::dsp::WindowingFunction<float>> window; ///< Hann windowing function
 
     // Data Buffers
-    float fifo[fftSize];                             ///< Input sample FIFO buffer
-    float fftData[2 * fftSize];                      ///< FFT input/output buffer (real + imaginary)
+    std::vector<float> fifo;                         ///< Input sample FIFO buffer (fftSize, empty while stopped)
+    std::vector<float> fftData;                      ///< FFT input/output buffer (2 * fftSize, empty while stopped)
     int fifoIndex = 0;                               ///< Current index in FIFO buffer
     bool nextFFTBlockReady = false;                  ///< Flag indicating when FFT block is ready
     float scopeData[scopeSize];                      ///< Processed spectrum data for display
 
+    // Filter Response Overlay
+    static constexpr int responsePoints = 256;       ///< Number of log-spaced response frequencies
+    static constexpr float responseMinDb = -60.0f;   ///< Response level at the bottom of the display
+    static constexpr float responseMaxDb = 12.0f;    ///< Response level at the top of the display
+    FilterResponse filterResponse;                   ///< Response of the current filter chain
+    bool hasFilterResponse = false;                  ///< Whether setFilterResponse() was called
+    juce::Path responsePath;                         ///< Cached response curve
+    juce::Rectangle<int> responsePathArea;           ///< Area responsePath was built for, empty if outdated
+
     // Audio Buffer References
     juce::AudioBuffer<float>& audioBuffer;           ///< Reference to the main audio buffer
     int& bufferWritePos;                             ///< Reference to current write position
@@ -138,5 +205,7 @@ private:
     float smoothingFactor = 0.8f;                    ///< Smoothing factor for spectrum display (0.0 = no smoothing, 1.0 = maximum smoothing)
     bool firstFrame = true;                          ///< Flag for first frame processing
 
+    juce::SharedResourcePointer<QualityGovernor> governor; ///< Measures paint time, sets resolution and frame rate
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumComponent)
 };
\ No newline at end of file
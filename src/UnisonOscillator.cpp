@@ -0,0 +1,62 @@
+/**
+ * @file UnisonOscillator.cpp
+ * @brief Implementation of the UnisonOscillator class
+ */
+
+#include "UnisonOscillator.hpp"
+#include "FastMath.hpp"
+
+void UnisonOscillator::prepare(double newSampleRate)
+{
+    inverseSampleRate = static_cast<float>(1.0 / newSampleRate);
+}
+
+void UnisonOscillator::setVoices(int numVoices, float detuneCents, float stereoSpread)
+{
+    numVoices = juce::jlimit(1, maxVoices, numVoices);
+
+    if (numVoices == numActiveVoices && juce::approximatelyEqual(detuneCents, currentDetune) &&
+        juce::approximatelyEqual(stereoSpread, currentSpread))
+        return;
+
+    numActiveVoices = numVoices;
+    numGroups = (numVoices + laneGroupSize - 1) / laneGroupSize;
+    currentDetune = detuneCents;
+    currentSpread = stereoSpread;
+
+    // Normalise so the summed copies keep roughly the level of a single oscillator
+    const auto level = 1.0f / std::sqrt(static_cast<float>(numVoices));
+
+    for (int lane = 0; lane < maxVoices; ++lane)
+    {
+        const auto group = lane / laneGroupSize;
+        const auto index = static_cast<size_t>(lane % laneGroupSize);
+
+        if (lane >= numVoices)
+        {
+            // Silent padding lanes inside the last SIMD group
+            ratios[group].set(index, 1.0f);
+            leftGains[group].set(index, 0.0f);
+            rightGains[group].set(index, 0.0f);
+            continue;
+        }
+
+        // Position of this copy in the stack, from -1 (lowest/left) to +1 (highest/right)
+        const auto position = numVoices > 1 ? 2.0f * static_cast<float>(lane) / static_cast<float>(numVoices - 1) - 1.0f
+                                            : 0.0f;
+
+        ratios[group].set(index, std::exp2(detuneCents * position / 1200.0f));
+
+        // Equal-power panning over a quarter period (0 = hard left, 0.25 = hard right)
+        const auto panPhase = (position * stereoSpread + 1.0f) * 0.125f;
+        leftGains[group].set(index, FastMath::cos2pi(panPhase) * level);
+        rightGains[group].set(index, FastMath::sin2pi(panPhase) * level);
+    }
+}
+
+void UnisonOscillator::randomisePhases(juce::Random& random)
+{
+    for (auto& group : phases)
+        for (size_t index = 0; index < Register::SIMDNumElements; ++index)
+            group.set(index, random.nextFloat());
+}
@@ -0,0 +1,55 @@
+/**
+ * @file VoiceKeyboardComponent.cpp
+ * @brief Implementation of the VoiceKeyboardComponent class
+ */
+
+#include "VoiceKeyboardComponent.hpp"
+
+void VoiceKeyboardComponent::setSoundingNote(int note)
+{
+    if (note == soundingNote)
+        return;
+
+    // Only the keys that change need to be redrawn
+    repaintNote(soundingNote);
+    soundingNote = note;
+    repaintNote(soundingNote);
+}
+
+void VoiceKeyboardComponent::setSoundingNoteColour(juce::Colour colour)
+{
+    soundingNoteColour = colour;
+    repaintNote(soundingNote);
+}
+
+void VoiceKeyboardComponent::drawWhiteNote(int midiNoteNumber, juce::Graphics& g, juce::Rectangle<float> area,
+                                           bool isDown, bool isOver, juce::Colour lineColour, juce::Colour textColour)
+{
+    juce::MidiKeyboardComponent::drawWhiteNote(midiNoteNumber, g, area, isDown, isOver, lineColour, textColour);
+
+    if (midiNoteNumber == soundingNote)
+        drawSoundingNote(g, area);
+}
+
+void VoiceKeyboardComponent::drawBlackNote(int midiNoteNumber, juce::Graphics& g, juce::Rectangle<float> area,
+                                           bool isDown, bool isOver, juce::Colour noteFillColour)
+{
+    juce::MidiKeyboardComponent::drawBlackNote(midiNoteNumber, g, area, isDown, isOver, noteFillColour);
+
+    if (midiNoteNumber == soundingNote)
+        drawSoundingNote(g, area);
+}
+
+void VoiceKeyboardComponent::drawSoundingNote(juce::Graphics& g, juce::Rectangle<float> area) const
+{
+    // Glow rising from the bottom of the key
+    g.setGradientFill(juce::ColourGradient(soundingNoteColour.withAlpha(0.6f), area.getCentreX(), area.getBottom(),
+                                           soundingNoteColour.withAlpha(0.0f), area.getCentreX(), area.getY(), false));
+    g.fillRect(area.reduced(1.0f, 0.0f));
+}
+
+void VoiceKeyboardComponent::repaintNote(int note)
+{
+    if (note >= 0)
+        repaint(getRectangleForKey(note).getSmallestIntegerContainer());
+}
@@ -0,0 +1,61 @@
+/**
+ * @file VoiceKeyboardComponent.hpp
+ * @brief On-screen keyboard that highlights the sounding note
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class VoiceKeyboardComponent
+ * @brief juce::MidiKeyboardComponent that also marks the note the synth is playing
+ *
+ * The base class shows the keys held down in the keyboard state. A note keeps
+ * sounding through its release after the key is let go, and with several keys
+ * held only the last one is played. This component draws a glow over the key
+ * of the note the voice actually plays, as published by the processor.
+ */
+class VoiceKeyboardComponent : public juce::MidiKeyboardComponent
+{
+public:
+    using juce::MidiKeyboardComponent::MidiKeyboardComponent;
+
+    /**
+     * @brief Sets the note the voice is playing
+     * @param note MIDI note number, -1 if the voice is silent
+     */
+    void setSoundingNote(int note);
+
+    /**
+     * @brief Sets the colour of the sounding note glow
+     * @param colour Glow colour
+     */
+    void setSoundingNoteColour(juce::Colour colour);
+
+protected:
+    /** @brief Draws a white key plus the glow if it is the sounding note */
+    void drawWhiteNote(int midiNoteNumber, juce::Graphics& g, juce::Rectangle<float> area, bool isDown, bool isOver,
+                       juce::Colour lineColour, juce::Colour textColour) override;
+
+    /** @brief Draws a black key plus the glow if it is the sounding note */
+    void drawBlackNote(int midiNoteNumber, juce::Graphics& g, juce::Rectangle<float> area, bool isDown, bool isOver,
+                       juce::Colour noteFillColour) override;
+
+private:
+    /**
+     * @brief Draws the sounding note glow over a key
+     * @param g Graphics context
+     * @param area Key area
+     */
+    void drawSoundingNote(juce::Graphics& g, juce::Rectangle<float> area) const;
+
+    /**
+     * @brief Repaints a single key
+     * @param note MIDI note number, ignored if negative
+     */
+    void repaintNote(int note);
+
+    int soundingNote = -1;                                  ///< Note the voice is playing, -1 if silent
+    juce::Colour soundingNoteColour = juce::Colour(0xff64b5f6); ///< Glow colour
+};
@@ -12,8 +12,8 @@
  * @brief Constructs the WaveformComponent with audio buffer references
  *
  * Initializes the component to visualize the provided audio buffer data.
- * Starts a timer at 60Hz to continuously update the display, providing
- * smooth real-time visualization of the audio waveform.
+ * The 60Hz update timer is started by updateTimerState() once the component
+ * is showing.
  *
  * @param bufferRef Reference to the audio buffer containing the data to visualize
  * @param writePosRef Reference to the current write position in the circular buffer
@@ -22,9 +22,7 @@
  *       writePos indicates the most recently written sample position
  */
 WaveformComponent::WaveformComponent(juce::AudioSampleBuffer &bufferRef, int &writePosRef)
-    : buffer(bufferRef), writePos(writePosRef) {
-    startTimerHz(60); // Starts timer to refresh display at ~60 frames per second
-}
+    : buffer(bufferRef), writePos(writePosRef) {}
 
 /**
  * @brief Handles the rendering of the component
@@ -36,6 +34,12 @@ WaveformComponent::WaveformComponent(juce::AudioSampleBuffer &bufferRef, int &wr
  * @param g The graphics context used for drawing operations
  */
 void WaveformComponent::paint(juce::Graphics &g) {
+    // Being painted means being visible again, e.g. after the host window was restored
+    if (!isTimerRunning())
+        updateTimerState();
+
+    QualityGovernor::ScopedPaintTimer paintTimer(*governor);
+
     g.fillAll(juce::Colours::black);  // Set background to black for contrast
     g.setColour(juce::Colours::lime); // Set waveform color to lime green
     drawWaveform(g);                  // Draw the actual waveform visualization
@@ -45,13 +49,42 @@ void WaveformComponent::paint(juce::Graphics &g) {
  * @brief Timer callback that triggers display updates
  *
  * Overrides Timer::timerCallback to provide continuous display updates.
- * Called at the frequency set by startTimerHz() (60Hz) to maintain smooth
+ * Called at the rate of the current quality level (60Hz at full quality) to maintain smooth
  * real-time visualization of the changing audio buffer contents.
  */
 void WaveformComponent::timerCallback() {
+    // Minimising the host window does not notify the component, so check here
+    if (!isShowing()) {
+        stopTimer();
+        return;
+    }
+
+    // Follow the frame rate of the current quality level
+    if (getTimerInterval() != governor->getTimerInterval())
+        startTimer(governor->getTimerInterval());
+
     repaint(); // Request a repaint to update the visual display
 }
 
+void WaveformComponent::visibilityChanged() { updateTimerState(); }
+
+void WaveformComponent::parentHierarchyChanged() { updateTimerState(); }
+
+/**
+ * @brief Matches the display timer to the visibility of the component
+ *
+ * The waveform is always drawn from the current write position, so resuming
+ * needs no catching up on the samples written while hidden.
+ */
+void WaveformComponent::updateTimerState() {
+    if (isShowing()) {
+        if (!isTimerRunning())
+            startTimer(governor->getTimerInterval()); // ~60 frames per second at full quality
+    } else {
+        stopTimer();
+    }
+}
+
 /**
  * @brief Renders the audio waveform as a continuous line
  *
@@ -77,11 +110,22 @@ void WaveformComponent::drawWaveform(juce::Graphics &g) const {
     waveformPath.startNewSubPath(0.f, height / 2.f); // Start path at vertical center (zero amplitude)
 
     const int numSamples = buffer.getNumSamples();
+
+    // The buffer stays empty until the host first calls prepareToPlay
+    if (numSamples == 0) {
+        waveformPath.lineTo(static_cast<float>(width), height / 2.f);
+        g.strokePath(waveformPath, juce::PathStrokeType(1.0f));
+        return;
+    }
+
     const float step = static_cast<float>(numSamples) / width; // Calculate samples per pixel
     const int start = (writePos + 1) % numSamples;             // Get starting point after current write position
 
+    // Fewer points when the quality governor has lowered the drawing quality
+    const int stride = governor->getPointStride();
+
     // Draw the waveform point by point across the component width
-    for (int i = 0; i < width; ++i) {
+    for (int i = 0; i < width; i += stride) {
         // Calculate the actual sample index with wraparound for circular buffer
         const float index = std::fmod(start + i * step, static_cast<float>(numSamples));
         // Get the audio sample value at this index (assumes mono channel 0)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "QualityGovernor.hpp"
 
 /**
  * @brief A JUCE component that displays real-time audio waveform visualization
@@ -21,6 +22,9 @@
  * The component visualizes the audio data starting from the current write position
  * and wrapping around the circular buffer, providing a continuous scrolling effect
  * that shows the most recent audio data.
+ *
+ * The timer only runs while the component is showing, so a hidden editor or a
+ * minimised host window does not cause any repaints.
  */
 class WaveformComponent : public juce::Component, public juce::Timer {
   public:
@@ -28,7 +32,7 @@ class WaveformComponent : public juce::Component, public juce::Timer {
      * @brief Constructs the WaveformComponent with references to audio data
      *
      * Initializes the component with references to an audio buffer and its current
-     * write position. Starts an internal timer at 60Hz for display updates.
+     * write position. The 60Hz display timer starts once the component is showing.
      *
      * @param bufferRef Reference to the audio buffer containing the data to visualize
      * @param writePosRef Reference to the current write position in the buffer
@@ -47,12 +51,28 @@ class WaveformComponent : public juce::Component, public juce::Timer {
      */
     void paint(juce::Graphics &g) override;
 
+    /**
+     * @brief Starts or stops the display timer when the component is shown or hidden
+     */
+    void visibilityChanged() override;
+
+    /**
+     * @brief Starts or stops the display timer when the component moves to a shown or hidden parent
+     */
+    void parentHierarchyChanged() override;
+
   private:
+    /**
+     * @brief Runs the display timer if the component is showing, stops it otherwise
+     */
+    void updateTimerState();
+
     /**
      * @brief Timer callback for display updates
      *
      * Overrides Timer::timerCallback to trigger repainting of the component.
-     * Called at the frequency set by startTimerHz() (60Hz by default).
+     * Called at the rate of the current quality level (60Hz at full quality). Stops
+     * the timer if the component is no longer showing.
      */
     void timerCallback() override;
 
@@ -72,4 +92,6 @@ class WaveformComponent : public juce::Component, public juce::Timer {
 
     juce::AudioSampleBuffer &buffer; ///< Reference to the audio buffer to visualize
     int &writePos;                   ///< Reference to the current write position in the buffer
+
+    juce::SharedResourcePointer<QualityGovernor> governor; ///< Measures paint time, sets point stride and frame rate
 };
\ No newline at end of file
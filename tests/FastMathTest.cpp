@@ -0,0 +1,148 @@
+/**
+ * @file FastMathTest.cpp
+ * @brief Accuracy tests for the FastMath sine and cosine approximations
+ */
+
+#include "FastMath.hpp"
+#include "JuceHeader.h"
+#include <cmath>
+#include <vector>
+
+/**
+ * @class FastMathTest
+ * @brief Compares FastMath::sin2pi and cos2pi with std::sin and std::cos
+ *
+ * Checks the scalar, block and SIMDRegister versions over a wide phase range,
+ * and that the SIMD lanes return exactly the scalar results.
+ */
+class FastMathTest : public juce::UnitTest {
+public:
+    FastMathTest() : juce::UnitTest("FastMath", "FastMath") {}
+
+    void runTest() override
+    {
+        const auto phases = makePhases();
+
+        beginTest("Scalar sin2pi and cos2pi");
+        {
+            double sinError = 0.0;
+            double cosError = 0.0;
+
+            for (const auto phase : phases)
+            {
+                sinError = std::max(sinError, std::abs(FastMath::sin2pi(phase) - referenceSin(phase)));
+                cosError = std::max(cosError, getCosError(FastMath::cos2pi(phase), phase));
+            }
+
+            logMessage("Maximum scalar sin2pi error: " + juce::String(sinError));
+            expectLessThan(sinError, tolerance, "sin2pi error");
+            expectLessThan(cosError, 1.0, "cos2pi error relative to its tolerance");
+        }
+
+        beginTest("Block sin2pi");
+        {
+            // An odd length also covers the scalar remainder
+            const auto numSamples = static_cast<int>(phases.size()) - 1;
+            std::vector<float> output(phases.size());
+            FastMath::sin2pi(phases.data(), output.data(), numSamples);
+
+            double error = 0.0;
+            int mismatches = 0;
+
+            for (size_t i = 0; i < static_cast<size_t>(numSamples); ++i)
+            {
+                error = std::max(error, std::abs(output[i] - referenceSin(phases[i])));
+                mismatches += output[i] != FastMath::sin2pi(phases[i]) ? 1 : 0;
+            }
+
+            logMessage("Maximum block sin2pi error: " + juce::String(error));
+            expectLessThan(error, tolerance, "block sin2pi error");
+            expectEquals(mismatches, 0, "block sin2pi differs from the scalar version");
+        }
+
+        beginTest("SIMDRegister sin2pi and cos2pi");
+        {
+            using Register = juce::dsp::SIMDRegister<float>;
+            constexpr auto width = Register::SIMDNumElements;
+
+            double sinError = 0.0;
+            double cosError = 0.0;
+            int mismatches = 0;
+
+            for (size_t start = 0; start + width <= phases.size(); start += width)
+            {
+                alignas(Register::SIMDRegisterSize) float lanes[width];
+                alignas(Register::SIMDRegisterSize) float sines[width];
+                alignas(Register::SIMDRegisterSize) float cosines[width];
+                std::copy(phases.begin() + static_cast<std::ptrdiff_t>(start),
+                          phases.begin() + static_cast<std::ptrdiff_t>(start + width), lanes);
+
+                const auto registerPhases = Register::fromRawArray(lanes);
+                FastMath::sin2pi(registerPhases).copyToRawArray(sines);
+                FastMath::cos2pi(registerPhases).copyToRawArray(cosines);
+
+                for (size_t lane = 0; lane < width; ++lane)
+                {
+                    const auto phase = lanes[lane];
+                    sinError = std::max(sinError, std::abs(sines[lane] - referenceSin(phase)));
+                    cosError = std::max(cosError, getCosError(cosines[lane], phase));
+                    mismatches += sines[lane] != FastMath::sin2pi(phase) ? 1 : 0;
+                    mismatches += cosines[lane] != FastMath::cos2pi(phase) ? 1 : 0;
+                }
+            }
+
+            logMessage("Maximum SIMD sin2pi error: " + juce::String(sinError));
+            expectLessThan(sinError, tolerance, "SIMD sin2pi error");
+            expectLessThan(cosError, 1.0, "SIMD cos2pi error relative to its tolerance");
+            expectEquals(mismatches, 0, "SIMD results differ from the scalar version");
+        }
+    }
+
+private:
+    /// Documented error bound: polynomial plus float rounding of the reduced phase
+    static constexpr double tolerance = 2.5e-7;
+
+    /// Largest phase magnitude tested
+    static constexpr float phaseRange = 1024.0f;
+
+    /**
+     * @brief Builds the test phases
+     *
+     * A dense sweep over the first periods, where the oscillators spend most of
+     * their time, and random phases up to +/- phaseRange, where the reduction matters.
+     */
+    static std::vector<float> makePhases()
+    {
+        std::vector<float> phases;
+
+        for (int i = -8 * 8192; i <= 8 * 8192; ++i)
+            phases.push_back(static_cast<float>(i) / 8192.0f + 1.0e-5f);
+
+        juce::Random random(42);
+        for (int i = 0; i < 65536; ++i)
+            phases.push_back((2.0f * random.nextFloat() - 1.0f) * phaseRange);
+
+        return phases;
+    }
+
+    static double referenceSin(float phase) { return std::sin(juce::MathConstants<double>::twoPi * phase); }
+
+    /**
+     * @brief Error of a cos2pi result, relative to the error allowed at its phase
+     *
+     * cos2pi adds a quarter period before evaluating the sine, which rounds the
+     * phase to the float grid at its magnitude. Half an ulp of phase is pi * ulp
+     * in radians, so that much is allowed on top of the sine tolerance.
+     *
+     * @return Values up to 1.0 are within tolerance
+     */
+    static double getCosError(float result, float phase)
+    {
+        const auto magnitude = std::abs(phase) + 0.25f;
+        const auto ulp = static_cast<double>(std::nextafter(magnitude, 2.0f * magnitude) - magnitude);
+        const auto reference = std::cos(juce::MathConstants<double>::twoPi * phase);
+        return std::abs(result - reference) / (tolerance + juce::MathConstants<double>::pi * ulp);
+    }
+};
+
+static FastMathTest fastMathTest;
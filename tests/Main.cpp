@@ -0,0 +1,19 @@
+/**
+ * @file Main.cpp
+ * @brief Runs the PanTronic unit tests and reports failures through the exit code
+ */
+
+#include "JuceHeader.h"
+
+int main()
+{
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+    runner.runAllTests();
+
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        if (runner.getResult(i)->failures > 0)
+            return 1;
+
+    return 0;
+}